@@ -0,0 +1,54 @@
+#ifndef BITMAPS_H_
+#define BITMAPS_H_
+
+#include <stdint.h>
+
+// Run-length encoded bitmap, see Tools/bitmappack.py
+// The bitmap is cut into pages of 8 rows, a page being one byte per column,
+// LSB at the top. Each page of `width` bytes is encoded on its own in `data`
+// as runs introduced by a control byte n: n < 0x80, n + 1 literal bytes
+// follow; n >= 0x80, the next byte is repeated (n & 0x7F) + 1 times.
+// Rows below `height` in the last page are off
+typedef struct Bitmap {
+	const uint8_t *data;
+	const uint8_t width;
+	const uint8_t height;
+} Bitmap;
+
+// Drawing modes, can be combined
+#define BITMAP_OPAQUE      0x00 // Pixels off in the bitmap are cleared
+#define BITMAP_TRANSPARENT 0x01 // Only the pixels on in the bitmap are drawn
+#define BITMAP_INVERT      0x02 // Bitmap pixels are inverted first
+#define BITMAP_XOR         0x04 // Screen pixels under the pixels on are inverted
+
+// Icons (16x16)
+extern const Bitmap IconAlarm;
+extern const Bitmap IconSnooze;
+extern const Bitmap IconWeather;
+extern const Bitmap IconWifi;
+
+// Decodes one page of a bitmap into `width` column bytes, returns the
+// start of the next page in the stream
+static inline const uint8_t *BITMAP_DecodePage(const uint8_t *stream, uint8_t *page, uint8_t width)
+{
+	const uint8_t *end = page + width;
+
+	while (page < end)
+	{
+		uint8_t control = *stream++;
+		uint8_t count = (control & 0x7F) + 1;
+
+		if (control & 0x80)
+		{
+			uint8_t value = *stream++;
+			while (count--) *page++ = value;
+		}
+		else
+		{
+			while (count--) *page++ = *stream++;
+		}
+	}
+	return stream;
+}
+
+#endif /* BITMAPS_H */
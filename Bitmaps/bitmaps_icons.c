@@ -0,0 +1,61 @@
+#ifndef BITMAPS_BITMAPS_ICONS_H_
+#define BITMAPS_BITMAPS_ICONS_H_
+
+#include <stdint.h>
+#include "bitmaps.h"
+
+// Generated by Tools/bitmappack.py, do not edit
+
+// Bitmaps/Source/icon_alarm.pbm: 16x16, 32 -> 34 bytes
+static const uint8_t IconAlarm_Data[] =
+{
+	0x0F, 0x0E, 0xE7, 0x13, 0x08, 0x04, 0x04, 0x02, 0xF2, 0x02, 0x02, 0x04, 0x04, 0x08, 0x13, 0xE7, 0x0E,  // Page 0
+	0x06, 0x00, 0x07, 0x88, 0x50, 0x20, 0x20, 0x40, 0x82, 0x41, 0x05, 0x21, 0x20, 0x50, 0x88, 0x07, 0x00,  // Page 1
+};
+
+const Bitmap IconAlarm = {
+	.data = IconAlarm_Data,
+	.width = 16,
+	.height = 16
+};
+
+// Bitmaps/Source/icon_snooze.pbm: 16x16, 32 -> 27 bytes
+static const uint8_t IconSnooze_Data[] =
+{
+	0x82, 0x00, 0x0C, 0x20, 0x20, 0xA0, 0x60, 0x20, 0x01, 0x11, 0x19, 0x15, 0x13, 0x11, 0x10, 0x00,  // Page 0
+	0x07, 0x88, 0xC8, 0xE8, 0xAA, 0x9B, 0x9A, 0x8A, 0x02, 0x87, 0x00,  // Page 1
+};
+
+const Bitmap IconSnooze = {
+	.data = IconSnooze_Data,
+	.width = 16,
+	.height = 16
+};
+
+// Bitmaps/Source/icon_weather.pbm: 16x16, 32 -> 27 bytes
+static const uint8_t IconWeather_Data[] =
+{
+	0x08, 0x10, 0x92, 0x54, 0x38, 0x8F, 0x4C, 0x2C, 0x1A, 0x10, 0x83, 0x20, 0x02, 0x40, 0x80, 0x00,  // Page 0
+	0x04, 0x00, 0x18, 0x24, 0x42, 0x41, 0x88, 0x40, 0x01, 0x23, 0x1C,  // Page 1
+};
+
+const Bitmap IconWeather = {
+	.data = IconWeather_Data,
+	.width = 16,
+	.height = 16
+};
+
+// Bitmaps/Source/icon_wifi.pbm: 16x16, 32 -> 27 bytes
+static const uint8_t IconWifi_Data[] =
+{
+	0x04, 0x20, 0x10, 0x90, 0x48, 0x68, 0x85, 0x24, 0x04, 0x68, 0x48, 0x90, 0x10, 0x20,  // Page 0
+	0x83, 0x00, 0x07, 0x02, 0x11, 0x09, 0xC9, 0xC9, 0x09, 0x11, 0x02, 0x83, 0x00,  // Page 1
+};
+
+const Bitmap IconWifi = {
+	.data = IconWifi_Data,
+	.width = 16,
+	.height = 16
+};
+
+#endif
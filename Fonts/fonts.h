@@ -3,12 +3,24 @@
 
 #include <stdint.h>
 
+// Packed glyph, see Tools/fontpack.py
+// Only the non-empty columns and bytes of the glyph are stored in Font.data: 
+// `columns` columns of `byteCount` bytes, LSB first, starting at column 
+// `xOffset` and at row 8*`firstByte` of the character cell
+typedef struct FontGlyph {
+	const uint16_t offset;
+	const uint8_t advance;
+	const uint8_t xOffset;
+	const uint8_t columns;
+	const uint8_t firstByte;
+	const uint8_t byteCount;
+} FontGlyph;
+
 typedef struct Font {
 	const uint8_t *data;
+	const FontGlyph *glyphs;
 	const uint8_t asciiBegin;
 	const uint8_t asciiEnd;
-	const uint8_t asciiOffset;
-	const uint8_t datasize;
 	const uint8_t length;
 	const uint8_t height;
 	const uint8_t bytesPerColums;
@@ -18,4 +30,27 @@ typedef struct Font {
 extern const Font Arial28x28;
 extern const Font Arial12x12;
 
+// Returns the glyph of a character, 0 if the font does not contain it
+static inline const FontGlyph *FONT_GetGlyph(const Font *font, uint8_t letterNumberAscii)
+{
+	if (letterNumberAscii < font->asciiBegin || letterNumberAscii > font->asciiEnd) return 0;
+	return &font->glyphs[letterNumberAscii - font->asciiBegin];
+}
+
+// Returns the width of a string as drawn by DrawStr: the advances of its
+// characters and the letter spacing between them (characters missing from
+// the font are skipped)
+static inline uint16_t FONT_TextWidth(const Font *font, const char *text)
+{
+	uint16_t width = 0;
+	uint8_t spacing = font->length / 10;
+
+	for (; *text; text++)
+	{
+		const FontGlyph *glyph = FONT_GetGlyph(font, *text);
+		if (glyph) width += glyph->advance + spacing;
+	}
+	return width ? width - spacing : 0;
+}
+
 #endif /* FONTS_H */
@@ -0,0 +1,23 @@
+#ifndef SH1106_MOCK_H_
+#define SH1106_MOCK_H_
+
+#include <stdint.h>
+
+// Simulated SH1106 behind the host port (Src/sh1106_port_host.c)
+
+#define SH1106_MOCK_COLUMNS 132 // Display RAM columns
+#define SH1106_MOCK_VISIBLE 128 // Columns on the glass, from SH1106_MOCK_FIRST
+#define SH1106_MOCK_FIRST   2
+
+typedef struct
+{
+	uint32_t dataBytes;    // Bytes written to the display RAM
+	uint32_t commandBytes; // Command bytes, arguments included
+	uint32_t selects;      // CS low pulses
+} SH1106_MOCK_CountersTypeDef;
+
+const uint8_t *SH1106_MOCK_GetRam(void);
+SH1106_MOCK_CountersTypeDef SH1106_MOCK_TakeCounters(void);
+int SH1106_MOCK_WritePBM(const char *path);
+
+#endif /* SH1106_MOCK_H_ */
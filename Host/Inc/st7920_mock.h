@@ -0,0 +1,27 @@
+#ifndef ST7920_MOCK_H_
+#define ST7920_MOCK_H_
+
+#include <stdint.h>
+
+// Simulated ST7920 behind the host port (Src/st7920_port_host.c)
+
+#define ST7920_MOCK_GDRAM_ROWS  32 // GDRAM rows, each holds a row of both screen halves
+#define ST7920_MOCK_GDRAM_BYTES 32 // Bytes per GDRAM row (16 words)
+#define ST7920_MOCK_DDRAM_SIZE  64 // Characters in DDRAM (32 addresses of 2 characters)
+
+typedef struct
+{
+	uint32_t commandFrames; // Instruction frames
+	uint32_t dataFrames;    // Data frames (one byte each)
+	uint32_t selects;       // CS high pulses
+	uint32_t functionSets;  // Function set instructions (basic/extended switches)
+	uint32_t errors;        // Malformed or cut frames, half-written words
+	uint32_t earlyFrames;   // Frames received while the previous one was executing
+} ST7920_MOCK_CountersTypeDef;
+
+void ST7920_MOCK_GetImage(uint8_t *image);
+char ST7920_MOCK_GetChar(uint8_t row, uint8_t column);
+uint8_t ST7920_MOCK_IsGraphic(void);
+ST7920_MOCK_CountersTypeDef ST7920_MOCK_TakeCounters(void);
+
+#endif /* ST7920_MOCK_H_ */
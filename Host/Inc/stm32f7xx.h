@@ -0,0 +1,110 @@
+#ifndef STM32F7XX_HOST_H
+#define STM32F7XX_HOST_H
+
+// Host replacement of the CMSIS device header
+// Peripherals are plain structures in RAM so that the display drivers 
+// build and run on a workstation, see Src/stm32_host.c
+
+#include <stdint.h>
+
+#define __IO volatile
+#define __ALIGNED(x) __attribute__((aligned(x)))
+
+typedef struct {
+	__IO uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2];
+} GPIO_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR, PLLCFGR, CFGR, CIR, AHB1RSTR, AHB2RSTR, AHB3RSTR, RESERVED0;
+	__IO uint32_t APB1RSTR, APB2RSTR, RESERVED1[2], AHB1ENR, AHB2ENR, AHB3ENR, RESERVED2;
+	__IO uint32_t APB1ENR, APB2ENR;
+} RCC_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR1, CR2, SR, DR, CRCPR, RXCRCR, TXCRCR, I2SCFGR, I2SPR;
+} SPI_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR, NDTR, PAR, M0AR, M1AR, FCR;
+} DMA_Stream_TypeDef;
+
+typedef struct {
+	__IO uint32_t LISR, HISR, LIFCR, HIFCR;
+} DMA_TypeDef;
+
+typedef enum {
+	DMA2_Stream3_IRQn = 59
+} IRQn_Type;
+
+extern GPIO_TypeDef HOST_GPIOA, HOST_GPIOC;
+extern RCC_TypeDef HOST_RCC;
+extern SPI_TypeDef HOST_SPI1;
+extern DMA_TypeDef HOST_DMA2;
+extern DMA_Stream_TypeDef HOST_DMA2_Stream3;
+extern uint32_t SystemCoreClock;
+extern uint32_t HOST_Microseconds;
+
+#define GPIOA        (&HOST_GPIOA)
+#define GPIOC        (&HOST_GPIOC)
+#define RCC          (&HOST_RCC)
+#define SPI1         (&HOST_SPI1)
+#define DMA2         (&HOST_DMA2)
+#define DMA2_Stream3 (&HOST_DMA2_Stream3)
+
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+
+// RCC
+#define RCC_AHB1ENR_GPIOAEN (1U << 0)
+#define RCC_AHB1ENR_GPIOCEN (1U << 2)
+#define RCC_AHB1ENR_DMA2EN  (1U << 22)
+#define RCC_APB2ENR_SPI1EN  (1U << 12)
+
+// GPIO
+#define GPIO_MODER_MODER0_0 (1U << 0)
+#define GPIO_MODER_MODER0_1 (2U << 0)
+#define GPIO_MODER_MODER1_0 (1U << 2)
+#define GPIO_MODER_MODER1_1 (2U << 2)
+#define GPIO_MODER_MODER5_0 (1U << 10)
+#define GPIO_MODER_MODER5_1 (2U << 10)
+#define GPIO_MODER_MODER7_0 (1U << 14)
+#define GPIO_MODER_MODER7_1 (2U << 14)
+#define GPIO_AFRL_AFRL5_Pos 20U
+#define GPIO_AFRL_AFRL7_Pos 28U
+#define GPIO_BSRR_BS0       (1U << 0)
+#define GPIO_BSRR_BS1       (1U << 1)
+#define GPIO_BSRR_BR0       (1U << 16)
+#define GPIO_BSRR_BR1       (1U << 17)
+
+// SPI
+#define SPI_CR1_CPHA     (1U << 0)
+#define SPI_CR1_CPOL     (1U << 1)
+#define SPI_CR1_MSTR     (1U << 2)
+#define SPI_CR1_BR_2     (1U << 5)
+#define SPI_CR1_SPE      (1U << 6)
+#define SPI_CR1_LSBFIRST (1U << 7)
+#define SPI_CR1_SSI      (1U << 8)
+#define SPI_CR1_SSM      (1U << 9)
+#define SPI_CR2_TXDMAEN  (1U << 1)
+#define SPI_SR_TXE       (1U << 1)
+#define SPI_SR_BSY       (1U << 7)
+#define SPI_SR_FRLVL     (3U << 9)
+#define SPI_SR_FTLVL     (3U << 11)
+
+// DMA
+#define DMA_SxCR_EN        (1U << 0)
+#define DMA_SxCR_TEIE      (1U << 2)
+#define DMA_SxCR_TCIE      (1U << 4)
+#define DMA_SxCR_DIR_0     (1U << 6)
+#define DMA_SxCR_MINC      (1U << 10)
+#define DMA_SxCR_CHSEL_Pos 25U
+#define DMA_SxFCR_DMDIS    (1U << 2)
+#define DMA_LISR_TEIF3     (1U << 25)
+#define DMA_LISR_TCIF3     (1U << 27)
+#define DMA_LIFCR_CFEIF3   (1U << 22)
+#define DMA_LIFCR_CDMEIF3  (1U << 24)
+#define DMA_LIFCR_CTEIF3   (1U << 25)
+#define DMA_LIFCR_CHTIF3   (1U << 26)
+#define DMA_LIFCR_CTCIF3   (1U << 27)
+
+#endif /* STM32F7XX_HOST_H */
@@ -0,0 +1,39 @@
+#include "../../Inc/bench.h"
+#include "../../Inc/sh1106.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+// Host platform of the rendering benchmarks (Src/bench.c): nanoseconds 
+// from the monotonic clock, results on stdout. SendBuffer goes through the 
+// simulated controller, so only its CPU side is measured here.
+
+const char *const BENCH_Unit = "ns";
+
+void BENCH_ClockInit(void)
+{
+}
+
+uint32_t BENCH_Clock(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)(now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+void BENCH_Print(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	vprintf(format, args);
+	va_end(args);
+}
+
+int main(void)
+{
+	SH1106_Init();
+	SH1106_SetDoubleBuffer(1);
+	BENCH_Run();
+	return 0;
+}
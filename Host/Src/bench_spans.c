@@ -0,0 +1,145 @@
+#include "../../Inc/sh1106.h"
+#include "../../Inc/st7920.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// Span benchmark: buffer writes and time per shape, before (SetPixel 
+// through DrawLine, as the filled shapes were drawn before the span 
+// primitives) and after (page mask and whole byte spans)
+
+#define BENCH_ITERATIONS 20000
+
+extern uint32_t SH1106_PixelOps;
+extern uint32_t ST7920_PixelOps;
+
+typedef struct {
+	const char *name;
+	void (*draw)(int a, int b);
+	uint32_t *ops;
+} BENCH_ShapeTypeDef;
+
+// Previous filled shapes, one SetPixel per pixel through DrawLine
+static void LEGACY_SH1106_FilledRectangle(int w, int h)
+{
+	for (int i = 0; i <= h; i++) SH1106_DrawLine(1, 0, i, w, i);
+}
+
+static void LEGACY_ST7920_FilledRectangle(int w, int h)
+{
+	for (int i = 0; i <= h; i++) ST7920_DrawLine(1, 0, i, w, i);
+}
+
+#define LEGACY_FILLED_CIRCLE(DrawLine, x0, y0, r)                 \
+	do {                                                         \
+		int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r; \
+		DrawLine(1, x0 - r, y0, x0 + r, y0);                     \
+		while (x < y)                                            \
+		{                                                        \
+			if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }          \
+			x++; ddF_x += 2; f += ddF_x;                          \
+			DrawLine(1, x0 - x, y0 + y, x0 + x, y0 + y);          \
+			DrawLine(1, x0 - x, y0 - y, x0 + x, y0 - y);          \
+			DrawLine(1, x0 - y, y0 + x, x0 + y, y0 + x);          \
+			DrawLine(1, x0 - y, y0 - x, x0 + y, y0 - x);          \
+		}                                                        \
+	} while (0)
+
+static void LEGACY_SH1106_FilledCircle(int r, int unused)
+{
+	(void)unused;
+	LEGACY_FILLED_CIRCLE(SH1106_DrawLine, 63, 31, r);
+}
+
+static void LEGACY_ST7920_FilledCircle(int r, int unused)
+{
+	(void)unused;
+	LEGACY_FILLED_CIRCLE(ST7920_DrawLine, 63, 31, r);
+}
+
+static void LEGACY_SH1106_Separator(int w, int y)
+{
+	SH1106_DrawLine(1, 0, y, w - 1, y);
+}
+
+static void LEGACY_ST7920_Separator(int w, int y)
+{
+	ST7920_DrawLine(1, 0, y, w - 1, y);
+}
+
+// Span versions
+static void SPAN_SH1106_FilledRectangle(int w, int h) { SH1106_DrawFilledRectangle(1, 0, 0, w, h); }
+static void SPAN_ST7920_FilledRectangle(int w, int h) { ST7920_DrawFilledRectangle(1, 0, 0, w, h); }
+static void SPAN_SH1106_FilledCircle(int r, int unused) { (void)unused; SH1106_DrawFilledCircle(1, 63, 31, r); }
+static void SPAN_ST7920_FilledCircle(int r, int unused) { (void)unused; ST7920_DrawFilledCircle(1, 63, 31, r); }
+static void SPAN_SH1106_Separator(int w, int y) { SH1106_DrawHLine(1, 0, y, w); }
+static void SPAN_ST7920_Separator(int w, int y) { ST7920_DrawHLine(1, 0, y, w); }
+
+static double BENCH_Seconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void BENCH_Compare(const char *shape, int a, int b, const BENCH_ShapeTypeDef *before, const BENCH_ShapeTypeDef *after)
+{
+	const BENCH_ShapeTypeDef *variants[2] = {before, after};
+	uint32_t ops[2];
+	double ns[2];
+
+	for (int v = 0; v < 2; v++)
+	{
+		*variants[v]->ops = 0;
+		variants[v]->draw(a, b);
+		ops[v] = *variants[v]->ops;
+
+		double start = BENCH_Seconds();
+		for (int i = 0; i < BENCH_ITERATIONS; i++) variants[v]->draw(a, b);
+		ns[v] = (BENCH_Seconds() - start) * 1e9 / BENCH_ITERATIONS;
+	}
+
+	printf("%-8s %-22s %8u %8u %6.1fx %10.0f %10.0f %6.1fx\n", before->name, shape,
+	       ops[0], ops[1], (double)ops[0] / ops[1], ns[0], ns[1], ns[0] / ns[1]);
+}
+
+int main(void)
+{
+	static const int rectangles[][2] = {{7, 7}, {31, 15}, {127, 63}};
+	static const int radii[] = {4, 12, 31};
+	char shape[40];
+
+	printf("%-8s %-22s %8s %8s %7s %10s %10s %7s\n", "driver", "shape", "ops/old", "ops/new", "ratio", "ns/old", "ns/new", "ratio");
+
+	for (int i = 0; i < 3; i++)
+	{
+		int w = rectangles[i][0], h = rectangles[i][1];
+		snprintf(shape, sizeof(shape), "filled rect %dx%d", w + 1, h + 1);
+		BENCH_Compare(shape, w, h,
+			&(BENCH_ShapeTypeDef){"SH1106", LEGACY_SH1106_FilledRectangle, &SH1106_PixelOps},
+			&(BENCH_ShapeTypeDef){"SH1106", SPAN_SH1106_FilledRectangle, &SH1106_PixelOps});
+		BENCH_Compare(shape, w, h,
+			&(BENCH_ShapeTypeDef){"ST7920", LEGACY_ST7920_FilledRectangle, &ST7920_PixelOps},
+			&(BENCH_ShapeTypeDef){"ST7920", SPAN_ST7920_FilledRectangle, &ST7920_PixelOps});
+	}
+
+	for (int i = 0; i < 3; i++)
+	{
+		snprintf(shape, sizeof(shape), "filled circle r=%d", radii[i]);
+		BENCH_Compare(shape, radii[i], 0,
+			&(BENCH_ShapeTypeDef){"SH1106", LEGACY_SH1106_FilledCircle, &SH1106_PixelOps},
+			&(BENCH_ShapeTypeDef){"SH1106", SPAN_SH1106_FilledCircle, &SH1106_PixelOps});
+		BENCH_Compare(shape, radii[i], 0,
+			&(BENCH_ShapeTypeDef){"ST7920", LEGACY_ST7920_FilledCircle, &ST7920_PixelOps},
+			&(BENCH_ShapeTypeDef){"ST7920", SPAN_ST7920_FilledCircle, &ST7920_PixelOps});
+	}
+
+	BENCH_Compare("separator line", SH1106_WIDTH, 37,
+		&(BENCH_ShapeTypeDef){"SH1106", LEGACY_SH1106_Separator, &SH1106_PixelOps},
+		&(BENCH_ShapeTypeDef){"SH1106", SPAN_SH1106_Separator, &SH1106_PixelOps});
+	BENCH_Compare("separator line", ST7920_WIDTH, 37,
+		&(BENCH_ShapeTypeDef){"ST7920", LEGACY_ST7920_Separator, &ST7920_PixelOps},
+		&(BENCH_ShapeTypeDef){"ST7920", SPAN_ST7920_Separator, &ST7920_PixelOps});
+
+	return 0;
+}
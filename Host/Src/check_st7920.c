@@ -0,0 +1,166 @@
+#include "../../Inc/st7920.h"
+#include "../Inc/st7920_mock.h"
+
+#include <stm32f7xx.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Sends frames and text through the ST7920 driver to the simulated
+// controller and checks what it decoded: the glass shows the frame and
+// the text, unchanged rows and characters are skipped, partial rows
+// start on a GDRAM word, the text goes through the basic instruction
+// set, graphic mode is back afterwards and no frame arrives before the
+// controller has executed the previous one. Prints the traffic and the
+// simulated transfer time of each step, exits with 1 at the first
+// difference.
+
+#define CHECK_ROW_SIZE (ST7920_WIDTH / ST7920_DATA_SIZE)
+
+typedef struct {
+	const char *name;
+	uint32_t dataFrames;     // Expected traffic of the step
+	uint32_t commandFrames;
+	uint32_t selects;
+	uint32_t functionSets;
+} CHECK_StepTypeDef;
+
+static uint8_t CHECK_Frame[CHECK_ROW_SIZE * ST7920_HEIGHT];
+static char CHECK_Text[ST7920_TEXT_ROWS][ST7920_TEXT_COLUMNS];
+
+static int CHECK_Send(const CHECK_StepTypeDef *step)
+{
+	static uint8_t image[CHECK_ROW_SIZE * ST7920_HEIGHT];
+
+	ST7920_CopyBuffer(CHECK_Frame);
+	uint32_t start = HOST_Microseconds;
+	ST7920_SendBuffer();
+	uint32_t time = HOST_Microseconds - start;
+	ST7920_MOCK_CountersTypeDef counters = ST7920_MOCK_TakeCounters();
+
+	printf("%-24s %8u %8u %8u %8u %8u\n", step->name, counters.dataFrames, counters.commandFrames,
+	       counters.selects, counters.functionSets, time);
+
+	if (counters.errors)
+	{
+		fprintf(stderr, "%s: %u malformed frames or half-written words\n", step->name, counters.errors);
+		return 1;
+	}
+	if (counters.earlyFrames)
+	{
+		fprintf(stderr, "%s: %u frames sent before the previous one was executed\n", step->name, counters.earlyFrames);
+		return 1;
+	}
+	if (counters.dataFrames != step->dataFrames || counters.commandFrames != step->commandFrames ||
+	    counters.selects != step->selects || counters.functionSets != step->functionSets)
+	{
+		fprintf(stderr, "%s: expected %u data, %u command frames, %u selects, %u function sets\n", step->name,
+		        step->dataFrames, step->commandFrames, step->selects, step->functionSets);
+		return 1;
+	}
+
+	ST7920_MOCK_GetImage(image);
+	for (int i = 0; i < (int)sizeof(image); i++)
+	{
+		if (image[i] != CHECK_Frame[i])
+		{
+			fprintf(stderr, "%s: GDRAM row %d byte %d is 0x%02X, expected 0x%02X\n", step->name,
+			        i / CHECK_ROW_SIZE, i % CHECK_ROW_SIZE, image[i], CHECK_Frame[i]);
+			return 1;
+		}
+	}
+
+	for (uint8_t row = 0; row < ST7920_TEXT_ROWS; row++)
+	{
+		for (uint8_t column = 0; column < ST7920_TEXT_COLUMNS; column++)
+		{
+			if (ST7920_MOCK_GetChar(row, column) != CHECK_Text[row][column])
+			{
+				fprintf(stderr, "%s: DDRAM row %u column %u is '%c', expected '%c'\n", step->name, row, column,
+				        ST7920_MOCK_GetChar(row, column), CHECK_Text[row][column]);
+				return 1;
+			}
+		}
+	}
+
+	if (!ST7920_MOCK_IsGraphic())
+	{
+		fprintf(stderr, "%s: the controller is not back in graphic mode\n", step->name);
+		return 1;
+	}
+
+	return 0;
+}
+
+static void CHECK_Print(uint8_t row, uint8_t column, const char *text)
+{
+	ST7920_TextPrint(row, column, "%s", text);
+	memcpy(&CHECK_Text[row][column], text, strlen(text));
+}
+
+int main(void)
+{
+	ST7920_Init();
+	ST7920_GraphicMode(1);
+	memset(CHECK_Text, ' ', sizeof(CHECK_Text));
+
+	// The start-up waits cover the clear, the other instructions are paced
+	ST7920_MOCK_CountersTypeDef init = ST7920_MOCK_TakeCounters();
+	if (init.errors || init.earlyFrames)
+	{
+		fprintf(stderr, "init: %u malformed, %u early frames\n", init.errors, init.earlyFrames);
+		return 1;
+	}
+
+	srand(7920);
+	for (int i = 0; i < (int)sizeof(CHECK_Frame); i++) CHECK_Frame[i] = rand();
+
+	printf("%-24s %8s %8s %8s %8s %8s\n", "step", "data", "command", "selects", "fnset", "us");
+
+	// Every row: two address frames and 16 data frames in one transfer
+	if (CHECK_Send(&(CHECK_StepTypeDef){"full refresh", 1024, 128, 64, 0})) return 1;
+	if (CHECK_Send(&(CHECK_StepTypeDef){"unchanged", 0, 0, 0, 0})) return 1;
+
+	// Odd byte of the upper half: the row starts on the word holding it
+	CHECK_Frame[10 * CHECK_ROW_SIZE + 5] ^= 0xFF;
+	if (CHECK_Send(&(CHECK_StepTypeDef){"one byte, upper half", 2, 2, 1, 0})) return 1;
+
+	// Even byte of the lower half, at the other end of the GDRAM row
+	CHECK_Frame[40 * CHECK_ROW_SIZE + 14] ^= 0x0F;
+	if (CHECK_Send(&(CHECK_StepTypeDef){"one byte, lower half", 2, 2, 1, 0})) return 1;
+
+	// First and last bytes of two rows: the whole rows, the others skipped
+	CHECK_Frame[3 * CHECK_ROW_SIZE] ^= 0x80;
+	CHECK_Frame[3 * CHECK_ROW_SIZE + 15] ^= 0x01;
+	CHECK_Frame[63 * CHECK_ROW_SIZE + 7] ^= 0x10;
+	CHECK_Frame[63 * CHECK_ROW_SIZE + 8] ^= 0x10;
+	if (CHECK_Send(&(CHECK_StepTypeDef){"two rows", 16 + 4, 4, 2, 0})) return 1;
+
+	// Two words in each of 24 rows, like the seconds of a large clock
+	for (int y = 13; y < 37; y++) CHECK_Frame[y * CHECK_ROW_SIZE + 9] ^= 0x3C;
+	for (int y = 13; y < 37; y++) CHECK_Frame[y * CHECK_ROW_SIZE + 10] ^= 0xF0;
+	if (CHECK_Send(&(CHECK_StepTypeDef){"24 rows, two words", 24 * 4, 24 * 2, 24, 0})) return 1;
+
+	// Columns 3 and 4 are in DDRAM pairs 1 and 2: columns 2 to 5 are sent,
+	// between a switch to the basic instruction set and back (one
+	// transfer each)
+	CHECK_Print(1, 3, "Hi");
+	if (CHECK_Send(&(CHECK_StepTypeDef){"text, two pairs", 4, 1 + 2, 1 + 2, 2})) return 1;
+
+	// Two text rows and a GDRAM row in the same frame
+	CHECK_Print(0, 0, "A");
+	CHECK_Print(3, 15, "Z");
+	CHECK_Frame[20 * CHECK_ROW_SIZE + 9] ^= 0xFF;
+	if (CHECK_Send(&(CHECK_StepTypeDef){"text and graphics", 2 + 4, 2 + 2 + 2, 1 + 2 + 2, 2})) return 1;
+
+	if (CHECK_Send(&(CHECK_StepTypeDef){"unchanged", 0, 0, 0, 0})) return 1;
+
+	// Graphic mode restarts with a full refresh
+	ST7920_GraphicMode(1);
+	ST7920_MOCK_TakeCounters();
+	if (CHECK_Send(&(CHECK_StepTypeDef){"after GraphicMode", 1024, 128, 64, 0})) return 1;
+
+	printf("\nST7920 transfers match the frames and the text\n");
+	return 0;
+}
@@ -0,0 +1,225 @@
+#include "../../Inc/sh1106.h"
+#include "../../Inc/screen.h"
+#include "../../Inc/clock.h"
+#include "../../Inc/sh1106_list.h"
+#include "../Inc/sh1106_mock.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+// Renders the firmware screens (Src/screen.c) through the SH1106 driver 
+// and the simulated controller, writes what the glass shows after each 
+// SH1106_SendBuffer to <directory>/NNN.pbm and prints per frame timings 
+// and transfer counters. Frames are deterministic: compare two runs with 
+// cmp or diff -r for pixel-exact regression checks.
+
+typedef struct {
+	const char *name;
+	void (*render)(int step);
+	int steps;
+	int margins;   // The display offset moves the screen: RAM rows 0 and 63 must stay blank
+} FRAMES_SceneTypeDef;
+
+static double FRAMES_Nanoseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+// Seconds rolling over the end of the century
+static void FRAMES_NewYear(int step)
+{
+	SCREEN_DateTypeDef date = {24.25f, 57, 59, 23, 4, 31, 12, 99, 0};
+	int second = date.second + step;
+
+	if (step >= 2) date.temperature = 24.5f;
+	if (second >= 60)
+	{
+		date = (SCREEN_DateTypeDef){24.5f, second - 60, 0, 0, 5, 1, 1, 0, 1};
+	}
+	else date.second = second;
+
+	SCREEN_Date(&date);
+}
+
+// Minutes 1 and 3: display offsets 1 and 63, the rows on the edges wrap around
+static void FRAMES_Shift(int step)
+{
+	SCREEN_DateTypeDef date = {24.25f, 30, 1 + 2 * step, 12, 3, 15, 6, 24, 0};
+
+	SCREEN_Date(&date);
+}
+
+static void FRAMES_Error(int step)
+{
+	(void)step;
+	SCREEN_Error("E:DS3231");
+}
+
+static void FRAMES_Settings(int step)
+{
+	SCREEN_Setting("Setting %s : %d", "min", 58 + step);
+}
+
+// Icons in every mode, over a filled band for the transparent ones 
+// (drawn straight into the buffer, keep it the last scene)
+static void FRAMES_Icons(int step)
+{
+	static const Bitmap *const icons[] = {&IconAlarm, &IconWifi, &IconSnooze, &IconWeather};
+	static const uint8_t modes[] = {BITMAP_OPAQUE, BITMAP_OPAQUE | BITMAP_INVERT, BITMAP_TRANSPARENT, BITMAP_TRANSPARENT | BITMAP_INVERT};
+
+	SH1106_ClearBuffer();
+	SH1106_DrawFilledRectangle(1, 0, 40, SH1106_WIDTH - 1, 23);
+	for (int i = 0; i < 4; i++)
+	{
+		// Step 1 moves the icons off the page alignment
+		SH1106_DrawBitmap(4 + 32 * i, 4 + 3 * step, icons[i], modes[step ? 3 - i : i]);
+		SH1106_DrawBitmap(4 + 32 * i, 44 + 3 * step, icons[i], modes[step ? 3 - i : i]);
+	}
+}
+
+// Lit pixels of the visible columns on the first and last RAM rows
+static int FRAMES_EdgeInk(void)
+{
+	const uint8_t *ram = SH1106_MOCK_GetRam();
+	int ink = 0;
+
+	for (int x = SH1106_MOCK_FIRST; x < SH1106_MOCK_FIRST + SH1106_MOCK_VISIBLE; x++)
+	{
+		ink += ram[x] & 0x01;
+		ink += (ram[(SH1106_PAGES - 1) * SH1106_MOCK_COLUMNS + x] >> 7) & 0x01;
+	}
+	return ink;
+}
+
+// Composite scene for the display list check, drawn either straight into
+// the buffer or recorded in the display list
+static void FRAMES_Composite(int list)
+{
+	if (list)
+	{
+		SH1106_LIST_Begin();
+		SH1106_LIST_FontPrint(1, 3, 2, &Arial12x12, "List %d:%02d", 12, 34);
+		SH1106_LIST_FontPrint(1, 20, 27, &Arial28x28, "%d", 42);
+		SH1106_LIST_DrawRectangle(1, 0, 0, SH1106_WIDTH - 1, SH1106_HEIGHT - 1);
+		SH1106_LIST_DrawLine(1, 5, 60, 120, 14);
+		SH1106_LIST_DrawCircle(1, 90, 36, 20);
+		SH1106_LIST_DrawFilledCircle(2, 100, 30, 11);
+		SH1106_LIST_DrawFilledRectangle(2, 60, 18, 40, 13);
+		SH1106_LIST_DrawBitmap(108, 3, &IconWifi, BITMAP_XOR);
+		SH1106_LIST_DrawBitmap(70, 45, &IconAlarm, BITMAP_OPAQUE);
+		SH1106_LIST_Render();
+	}
+	else
+	{
+		SH1106_ClearBuffer();
+		SH1106_FontPrint(1, 3, 2, &Arial12x12, "List %d:%02d", 12, 34);
+		SH1106_FontPrint(1, 20, 27, &Arial28x28, "%d", 42);
+		SH1106_DrawRectangle(1, 0, 0, SH1106_WIDTH - 1, SH1106_HEIGHT - 1);
+		SH1106_DrawLine(1, 5, 60, 120, 14);
+		SH1106_DrawCircle(1, 90, 36, 20);
+		SH1106_DrawFilledCircle(2, 100, 30, 11);
+		SH1106_DrawFilledRectangle(2, 60, 18, 40, 13);
+		SH1106_DrawBitmap(108, 3, &IconWifi, BITMAP_XOR);
+		SH1106_DrawBitmap(70, 45, &IconAlarm, BITMAP_OPAQUE);
+		SH1106_SendBuffer();
+	}
+	SH1106_WaitTransfer();
+}
+
+static const FRAMES_SceneTypeDef FRAMES_Scenes[] = {
+	{"date", FRAMES_NewYear, 6, 1},
+	{"error", FRAMES_Error, 2, 0},
+	{"date", FRAMES_NewYear, 2, 1},
+	{"shift", FRAMES_Shift, 2, 1},
+	{"settings", FRAMES_Settings, 3, 0},
+	{"icons", FRAMES_Icons, 2, 0},
+};
+
+int main(int argc, char **argv)
+{
+	const char *directory = (argc > 1) ? argv[1] : "build/frames";
+	char path[256];
+	int frame = 0;
+
+	mkdir(directory, 0777);
+
+	SH1106_Init();
+	SH1106_SetDoubleBuffer(1);
+	SH1106_ClearBuffer();
+	CLOCK_Init();
+	SH1106_MOCK_CountersTypeDef init = SH1106_MOCK_TakeCounters();
+	printf("init: %u command bytes\n\n", init.commandBytes);
+
+	printf("%-5s %-10s %10s %10s %8s %8s %8s %8s %8s\n", "frame", "screen", "render ns", "send ns", "windows", "data", "commands", "selects", "direct");
+
+	for (unsigned i = 0; i < sizeof(FRAMES_Scenes) / sizeof(FRAMES_Scenes[0]); i++)
+	{
+		const FRAMES_SceneTypeDef *scene = &FRAMES_Scenes[i];
+
+		for (int step = 0; step < scene->steps; step++, frame++)
+		{
+			double start = FRAMES_Nanoseconds();
+			scene->render(step);
+			double rendered = FRAMES_Nanoseconds();
+			// Commands sent while rendering (start line, display offset)
+			SH1106_MOCK_CountersTypeDef direct = SH1106_MOCK_TakeCounters();
+			SH1106_SendBuffer();
+			SH1106_WaitTransfer();
+			double sent = FRAMES_Nanoseconds();
+
+			SH1106_MOCK_CountersTypeDef counters = SH1106_MOCK_TakeCounters();
+			const SH1106_StatsTypeDef *stats = SH1106_GetStats();
+
+			// The driver counters and the decoded traffic must agree
+			if (counters.dataBytes != stats->bytesSent || counters.commandBytes != stats->commandsSent)
+			{
+				fprintf(stderr, "frame %d: driver sent %u/%u bytes, controller got %u/%u\n", frame,
+				        stats->bytesSent, stats->commandsSent, counters.dataBytes, counters.commandBytes);
+				return 1;
+			}
+
+			if (scene->margins && FRAMES_EdgeInk())
+			{
+				fprintf(stderr, "frame %d: ink on RAM row 0 or 63 wraps to the other edge\n", frame);
+				return 1;
+			}
+
+			snprintf(path, sizeof(path), "%s/%03d.pbm", directory, frame);
+			if (SH1106_MOCK_WritePBM(path))
+			{
+				perror(path);
+				return 1;
+			}
+
+			printf("%-5d %-10s %10.0f %10.0f %8u %8u %8u %8u %8u\n", frame, scene->name, rendered - start, sent - rendered,
+			       stats->windowsSent, counters.dataBytes, counters.commandBytes, counters.selects, direct.commandBytes);
+		}
+	}
+
+	// The display list must put the same pixels in the display RAM
+	static uint8_t expected[SH1106_PAGES * SH1106_MOCK_COLUMNS];
+	FRAMES_Composite(0);
+	memcpy(expected, SH1106_MOCK_GetRam(), sizeof(expected));
+	SH1106_MOCK_TakeCounters();
+
+	double start = FRAMES_Nanoseconds();
+	FRAMES_Composite(1);
+	double sent = FRAMES_Nanoseconds();
+	SH1106_MOCK_CountersTypeDef counters = SH1106_MOCK_TakeCounters();
+	const SH1106_LIST_StatsTypeDef *list = SH1106_LIST_GetStats();
+
+	printf("\nlist: %u commands, %u replayed, %u culled, %u dropped, %u data bytes, %.0f ns\n", list->commands,
+	       list->replayed, list->culled, list->dropped, counters.dataBytes, sent - start);
+
+	if (memcmp(expected, SH1106_MOCK_GetRam(), sizeof(expected)))
+	{
+		fprintf(stderr, "list: display RAM differs from the buffer rendering\n");
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,151 @@
+#include "../../Inc/sh1106.h"
+#include "../../Inc/sh1106_port.h"
+#include "../Inc/sh1106_mock.h"
+
+#include <stdio.h>
+
+// Host port of the SH1106 driver: every byte goes to a simulated
+// controller that decodes the page and column address commands into
+// its own display RAM, so what is dumped is what the glass would show.
+// Streams complete immediately, SH1106_StreamComplete is called from
+// SH1106_PORT_Stream as the DMA interrupt would be.
+
+static uint8_t MOCK_Ram[SH1106_PAGES][SH1106_MOCK_COLUMNS];
+static uint8_t MOCK_Page = 0;
+static uint8_t MOCK_Column = 0;
+static uint8_t MOCK_Mode = SH1106_PORT_CMD;
+static uint8_t MOCK_Argument = 0; // Command waiting for its argument byte
+static uint8_t MOCK_StartLine = 0;
+static uint8_t MOCK_Offset = 0;
+static SH1106_MOCK_CountersTypeDef MOCK_Counters;
+
+// Commands followed by one argument byte
+static uint8_t MOCK_HasArgument(uint8_t cmd)
+{
+	switch (cmd)
+	{
+		case SH1106_CMD_CONTRAST:
+		case SH1106_CMD_SETMUX:
+		case SH1106_CMD_DCDC:
+		case SH1106_CMD_SETOFFS:
+		case SH1106_CMD_CLOCKDIV:
+		case SH1106_CMD_DPCHARGE_PER:
+		case SH1106_CMD_COM_HW:
+		case SH1106_CMD_VCOM_DLEVEL:
+			return 1;
+	}
+	return 0;
+}
+
+static void MOCK_Write(uint8_t byte)
+{
+	if (MOCK_Mode == SH1106_PORT_DATA)
+	{
+		// Columns past the RAM are dropped, the column counter does not wrap
+		if (MOCK_Column < SH1106_MOCK_COLUMNS) MOCK_Ram[MOCK_Page][MOCK_Column] = byte;
+		MOCK_Column++;
+		MOCK_Counters.dataBytes++;
+		return;
+	}
+
+	MOCK_Counters.commandBytes++;
+
+	if (MOCK_Argument)
+	{
+		if (MOCK_Argument == SH1106_CMD_SETOFFS) MOCK_Offset = byte & 0x3F;
+		MOCK_Argument = 0;
+		return;
+	}
+
+	if ((byte & 0xF0) == SH1106_CMD_COL_LOW) MOCK_Column = (MOCK_Column & 0xF0) | (byte & 0x0F);
+	else if ((byte & 0xF0) == SH1106_CMD_COL_HIGH) MOCK_Column = (MOCK_Column & 0x0F) | ((byte & 0x0F) << 4);
+	else if ((byte & 0xF0) == SH1106_CMD_PAGE_ADDR) MOCK_Page = byte & 0x07;
+	else if ((byte & 0xC0) == SH1106_CMD_STARTLINE) MOCK_StartLine = byte & 0x3F;
+	else if (MOCK_HasArgument(byte)) MOCK_Argument = byte;
+}
+
+void SH1106_PORT_Init(void)
+{
+}
+
+// The mock resets in one step, without waiting
+uint32_t SH1106_PORT_ResetStep(void)
+{
+	MOCK_Page = 0;
+	MOCK_Column = 0;
+	MOCK_Argument = 0;
+	MOCK_StartLine = 0;
+	MOCK_Offset = 0;
+	return 0;
+}
+
+void SH1106_PORT_SendCmd(uint8_t cmd)
+{
+	MOCK_Mode = SH1106_PORT_CMD;
+	MOCK_Counters.selects++;
+	MOCK_Write(cmd);
+}
+
+void SH1106_PORT_Begin(uint8_t mode)
+{
+	MOCK_Mode = mode;
+	MOCK_Counters.selects++;
+}
+
+void SH1106_PORT_SetMode(uint8_t mode)
+{
+	MOCK_Mode = mode;
+}
+
+void SH1106_PORT_Stream(const uint8_t *data, uint16_t size)
+{
+	while (size--) MOCK_Write(*data++);
+	SH1106_StreamComplete(0);
+}
+
+void SH1106_PORT_End(void)
+{
+}
+
+void SH1106_PORT_Release(void)
+{
+}
+
+const uint8_t *SH1106_MOCK_GetRam(void)
+{
+	return &MOCK_Ram[0][0];
+}
+
+// Returns the counters since the previous call
+SH1106_MOCK_CountersTypeDef SH1106_MOCK_TakeCounters(void)
+{
+	SH1106_MOCK_CountersTypeDef counters = MOCK_Counters;
+	MOCK_Counters = (SH1106_MOCK_CountersTypeDef){0};
+	return counters;
+}
+
+// Writes the visible part of the display RAM as a binary PBM (1 = lit),
+// rows taken through the start line and display offset as the glass shows them
+int SH1106_MOCK_WritePBM(const char *path)
+{
+	FILE *file = fopen(path, "wb");
+	if (!file) return -1;
+
+	fprintf(file, "P4\n%d %d\n", SH1106_MOCK_VISIBLE, SH1106_HEIGHT);
+	for (int row = 0; row < SH1106_HEIGHT; row++)
+	{
+		int y = (row + MOCK_StartLine + MOCK_Offset) % SH1106_HEIGHT;
+		for (int x = 0; x < SH1106_MOCK_VISIBLE; x += 8)
+		{
+			uint8_t bits = 0;
+			for (int n = 0; n < 8; n++)
+			{
+				uint8_t byte = MOCK_Ram[y / 8][SH1106_MOCK_FIRST + x + n];
+				bits |= ((byte >> (y % 8)) & 1) << (7 - n);
+			}
+			fputc(bits, file);
+		}
+	}
+
+	return fclose(file);
+}
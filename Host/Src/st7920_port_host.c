@@ -0,0 +1,213 @@
+#include "../../Inc/st7920.h"
+#include "../../Inc/st7920_port.h"
+#include "../Inc/st7920_mock.h"
+
+#include <string.h>
+
+// Host port of the ST7920 driver: the serial bytes go to a simulated
+// controller that checks the 24-bit frames (sync byte, high nibble,
+// low nibble) and decodes them like the chip: function set, DDRAM
+// addresses and characters in the basic instruction set, two-step
+// GDRAM addresses and words in the extended one. Anything a real
+// controller would take differently is counted as an error.
+// Bytes take 8 SCLK cycles on the wire and advance the simulated time
+// (HOST_Microseconds); a frame that arrives before the controller is
+// done with the previous one is counted as early.
+
+// Wire time of a byte, and bytes the TX FIFO holds before TXE drops (roughly)
+#define MOCK_BYTE_US    (8 * 1000000 / ST7920_SCK_HZ)
+#define MOCK_FIFO_BYTES 2
+
+static uint8_t MOCK_Gdram[ST7920_MOCK_GDRAM_ROWS][ST7920_MOCK_GDRAM_BYTES];
+static char MOCK_Ddram[ST7920_MOCK_DDRAM_SIZE];
+static uint8_t MOCK_Selected = 0;
+static uint8_t MOCK_Frame[3];
+static uint8_t MOCK_FrameBytes = 0;
+static uint8_t MOCK_Extended = 0;     // RE bit of the function set
+static uint8_t MOCK_Graphic = 0;      // G bit of the extended function set
+static uint8_t MOCK_AddressStep = 0;  // GDRAM vertical address received, horizontal expected
+static uint8_t MOCK_Vertical = 0;
+static uint8_t MOCK_Horizontal = 0;
+static uint8_t MOCK_DdramAddress = 0;
+static uint8_t MOCK_Half = 0;         // First byte of a word (GDRAM) or pair (DDRAM) written
+static uint32_t MOCK_WireFree = 0;    // Time the last queued byte leaves the wire
+static uint32_t MOCK_Busy = 0;        // Time the controller is done with the last frame
+static ST7920_MOCK_CountersTypeDef MOCK_Counters;
+
+// DDRAM address of the first character of each text row
+static const uint8_t MOCK_TextLine[ST7920_TEXT_ROWS] = {
+	ST7920_CMD_LINE0 & 0x1F, ST7920_CMD_LINE1 & 0x1F, ST7920_CMD_LINE2 & 0x1F, ST7920_CMD_LINE3 & 0x1F};
+
+static void MOCK_Instruction(uint8_t cmd)
+{
+	MOCK_Counters.commandFrames++;
+
+	if ((cmd & 0xE0) == 0x20)
+	{
+		// Function set: RE selects the instruction set, G is only written with RE = 1
+		MOCK_Counters.functionSets++;
+		MOCK_Extended = (cmd >> 2) & 1;
+		if (MOCK_Extended) MOCK_Graphic = (cmd >> 1) & 1;
+		MOCK_AddressStep = 0;
+		return;
+	}
+
+	if (!(cmd & 0x80))
+	{
+		if (!MOCK_Extended && cmd == ST7920_CMD_LCD_CLS)
+		{
+			memset(MOCK_Ddram, ' ', sizeof(MOCK_Ddram));
+			MOCK_DdramAddress = 0;
+			MOCK_Half = 0;
+		}
+		return;
+	}
+
+	// A new address drops a word whose second byte never came
+	if (MOCK_Half) MOCK_Counters.errors++;
+	MOCK_Half = 0;
+
+	if (!MOCK_Extended)
+	{
+		MOCK_DdramAddress = cmd & 0x1F;
+		return;
+	}
+
+	if (MOCK_AddressStep == 0)
+	{
+		MOCK_Vertical = cmd & 0x7F;
+		MOCK_AddressStep = 1;
+	}
+	else
+	{
+		MOCK_Horizontal = cmd & 0x0F;
+		MOCK_AddressStep = 0;
+	}
+}
+
+static void MOCK_Data(uint8_t data)
+{
+	MOCK_Counters.dataFrames++;
+
+	if (!MOCK_Extended)
+	{
+		MOCK_Ddram[MOCK_DdramAddress * 2 + MOCK_Half] = data;
+		MOCK_Half ^= 1;
+		if (!MOCK_Half) MOCK_DdramAddress = (MOCK_DdramAddress + 1) % (ST7920_MOCK_DDRAM_SIZE / 2);
+		return;
+	}
+
+	// Data between the two GDRAM address instructions
+	if (MOCK_AddressStep) MOCK_Counters.errors++;
+
+	if (MOCK_Vertical < ST7920_MOCK_GDRAM_ROWS) MOCK_Gdram[MOCK_Vertical][MOCK_Horizontal * 2 + MOCK_Half] = data;
+	MOCK_Half ^= 1;
+	if (!MOCK_Half) MOCK_Horizontal = (MOCK_Horizontal + 1) % (ST7920_MOCK_GDRAM_BYTES / 2);
+}
+
+void ST7920_PORT_Init(void)
+{
+}
+
+void ST7920_PORT_Reset(uint8_t active)
+{
+	if (!active) return;
+
+	// Power-on content: whatever the driver does not write shows up in the checks
+	memset(MOCK_Gdram, 0x55, sizeof(MOCK_Gdram));
+	memset(MOCK_Ddram, 0, sizeof(MOCK_Ddram));
+	MOCK_FrameBytes = 0;
+	MOCK_Extended = 0;
+	MOCK_Graphic = 0;
+	MOCK_AddressStep = 0;
+	MOCK_Half = 0;
+	MOCK_Busy = HOST_Microseconds;
+}
+
+void ST7920_PORT_Select(void)
+{
+	MOCK_Selected = 1;
+	MOCK_FrameBytes = 0;
+	MOCK_Counters.selects++;
+}
+
+void ST7920_PORT_Write(uint8_t byte)
+{
+	if (!MOCK_Selected)
+	{
+		MOCK_Counters.errors++;
+		return;
+	}
+
+	// The CPU waits for room in the FIFO, the byte follows the previous ones on the wire
+	if ((int32_t)(MOCK_WireFree - HOST_Microseconds) > MOCK_FIFO_BYTES * MOCK_BYTE_US)
+		HOST_Microseconds = MOCK_WireFree - MOCK_FIFO_BYTES * MOCK_BYTE_US;
+	if ((int32_t)(MOCK_WireFree - HOST_Microseconds) < 0) MOCK_WireFree = HOST_Microseconds;
+	MOCK_WireFree += MOCK_BYTE_US;
+
+	MOCK_Frame[MOCK_FrameBytes++] = byte;
+	if (MOCK_FrameBytes < sizeof(MOCK_Frame)) return;
+	MOCK_FrameBytes = 0;
+
+	// The frame is taken when its last bit arrives
+	if ((int32_t)(MOCK_WireFree - MOCK_Busy) < 0) MOCK_Counters.earlyFrames++;
+
+	// Sync byte 11111 RW RS 0 with RW = 0, then D7-D4 and D3-D0 in the high nibbles
+	uint8_t sync = MOCK_Frame[0];
+	if ((sync != ST7920_CMD && sync != ST7920_DATA) || (MOCK_Frame[1] & 0x0F) || (MOCK_Frame[2] & 0x0F))
+	{
+		MOCK_Counters.errors++;
+		return;
+	}
+
+	uint8_t value = MOCK_Frame[1] | (MOCK_Frame[2] >> 4);
+	uint8_t clear = (sync == ST7920_CMD && !MOCK_Extended && value == ST7920_CMD_LCD_CLS);
+	MOCK_Busy = MOCK_WireFree + (clear ? ST7920_CLS_US : ST7920_EXEC_US);
+
+	if (sync == ST7920_CMD) MOCK_Instruction(value);
+	else MOCK_Data(value);
+}
+
+void ST7920_PORT_Deselect(void)
+{
+	// CS low resets the serial counter: a frame cut here is lost
+	if (MOCK_FrameBytes) MOCK_Counters.errors++;
+	MOCK_FrameBytes = 0;
+	MOCK_Selected = 0;
+
+	// The CPU waits until the last byte has left
+	if ((int32_t)(MOCK_WireFree - HOST_Microseconds) > 0) HOST_Microseconds = MOCK_WireFree;
+}
+
+// Copies the GDRAM as the glass shows it, in the layout of the driver
+// buffer: the lower half of the screen is the right half of the GDRAM
+void ST7920_MOCK_GetImage(uint8_t *image)
+{
+	const uint8_t rowSize = ST7920_WIDTH / ST7920_DATA_SIZE;
+
+	for (uint8_t y = 0; y < ST7920_HEIGHT; y++)
+	{
+		const uint8_t *row = (y < ST7920_MOCK_GDRAM_ROWS) ? MOCK_Gdram[y] : &MOCK_Gdram[y - ST7920_MOCK_GDRAM_ROWS][rowSize];
+		memcpy(&image[y * rowSize], row, rowSize);
+	}
+}
+
+// Returns the character shown at a text position
+char ST7920_MOCK_GetChar(uint8_t row, uint8_t column)
+{
+	return MOCK_Ddram[MOCK_TextLine[row] * 2 + column];
+}
+
+// Returns 1 in the extended instruction set with the graphic display on
+uint8_t ST7920_MOCK_IsGraphic(void)
+{
+	return MOCK_Extended && MOCK_Graphic;
+}
+
+// Returns the counters since the previous call
+ST7920_MOCK_CountersTypeDef ST7920_MOCK_TakeCounters(void)
+{
+	ST7920_MOCK_CountersTypeDef counters = MOCK_Counters;
+	MOCK_Counters = (ST7920_MOCK_CountersTypeDef){0};
+	return counters;
+}
@@ -0,0 +1,43 @@
+#include <stm32f7xx.h>
+
+#include "../../Inc/tim.h"
+
+// Peripheral registers in RAM
+GPIO_TypeDef HOST_GPIOA;
+GPIO_TypeDef HOST_GPIOC;
+RCC_TypeDef HOST_RCC;
+SPI_TypeDef HOST_SPI1 = {.SR = SPI_SR_TXE};
+DMA_TypeDef HOST_DMA2;
+DMA_Stream_TypeDef HOST_DMA2_Stream3;
+
+uint32_t SystemCoreClock = 16000000;
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+	(void)IRQn;
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+	(void)IRQn;
+	(void)priority;
+}
+
+// Simulated time: delays advance it instead of waiting, and the host
+// ports advance it by the time their bytes spend on the wire
+uint32_t HOST_Microseconds = 0;
+
+uint32_t TIM_GetMicroseconds(void)
+{
+	return HOST_Microseconds;
+}
+
+void TIM_WaitMicroseconds(uint32_t us)
+{
+	HOST_Microseconds += us;
+}
+
+void TIM_WaitMilliseconds(uint32_t ms)
+{
+	HOST_Microseconds += ms * 1000;
+}
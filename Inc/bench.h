@@ -0,0 +1,19 @@
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+
+// Rendering benchmarks: the suite (Src/bench.c) runs on the board when the
+// firmware is built with BENCH defined, and on the host (Host/Src/bench_host.c)
+
+#define BENCH_ITERATIONS 16
+
+void BENCH_Run(void);
+
+// Clock and output of the platform
+void BENCH_ClockInit(void);
+uint32_t BENCH_Clock(void);
+void BENCH_Print(const char *format, ...);
+extern const char *const BENCH_Unit;
+
+#endif /* BENCH_H_ */
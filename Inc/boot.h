@@ -0,0 +1,29 @@
+#ifndef BOOT_H_
+#define BOOT_H_
+
+#include <stdint.h>
+#include "timer.h"
+
+// Concurrent driver start-up (Src/boot.c)
+// A start-up sequence is a step function (SH1106_InitStep, ESP01_StartStep,
+// ...) that does the work of one state, advances its own state and returns
+// the milliseconds to wait before the next call, 0 once the sequence is
+// over. Each sequence waits on its own software timer instead of the core,
+// so the drivers come up side by side and the scheduler keeps running.
+
+#define BOOT_MAX_SEQUENCES 4
+
+typedef uint32_t (*BOOT_Step)(void);
+typedef void (*BOOT_Callback)(void);
+
+// Boot counters (milliseconds of TIM_GetMilliseconds)
+typedef struct {
+	uint32_t started;    // First sequence started
+	uint32_t finished;   // Last sequence over, 0 while one is running
+} BOOT_StatsTypeDef;
+
+uint8_t BOOT_Start(BOOT_Step step, BOOT_Callback done);
+uint8_t BOOT_IsDone(void);
+const BOOT_StatsTypeDef *BOOT_GetStats(void);
+
+#endif /* BOOT_H_ */
@@ -3,13 +3,34 @@
 
 #include <stm32f7xx.h>
 
-extern volatile uint8_t BUTTON_TopState; 
-extern volatile uint8_t BUTTON_BottomState;
-extern volatile uint8_t BUTTON_RightState;
-extern volatile uint8_t BUTTON_LeftState;
 extern volatile uint8_t BUTTON_Switch;
 
+// Input events: each interrupt source (one EXTI line per button, TIM4 for
+// the auto-repeat) fills its own single-producer ring, the application
+// drains them oldest first with BUTTONS_GetEvent. A press is never lost
+// while its ring has room; when a ring is full the newest event is dropped.
+#define BUTTONS_QUEUE_SIZE 8   // Events per source, power of two
+
+// Buttons
+#define BUTTON_TOP    0
+#define BUTTON_BOTTOM 1
+#define BUTTON_RIGHT  2
+#define BUTTON_LEFT   3
+
+// Input event
+typedef struct {
+	uint32_t time;    // TIM_GetMilliseconds when the interrupt came
+	uint8_t button;   // BUTTON_TOP ... BUTTON_LEFT
+	uint8_t repeat;   // 0 for a press, 1 for an auto-repeat of a held button
+} BUTTONS_EventTypeDef;
+
+// Called from the button interrupts after an event was queued (press or repeat)
+typedef void (*BUTTONS_Callback)(void);
+
 void BUTTONS_Init(void);
+void BUTTONS_SetCallback(BUTTONS_Callback callback);
+uint8_t BUTTONS_GetEvent(BUTTONS_EventTypeDef *event);
+void BUTTONS_Flush(void);
 void EXTI15_10_IRQHandler(void);
 void EXTI2_IRQHandler(void);
 void EXTI4_IRQHandler(void);
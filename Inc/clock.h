@@ -0,0 +1,25 @@
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <stm32f7xx.h>
+#include "sh1106.h"
+
+// Position of the HH:MM:SS clock on the main screen (in pixels)
+#define CLOCK_X      7
+#define CLOCK_Y      13
+#define CLOCK_HEIGHT 24
+#define CLOCK_FONT   Arial28x28
+
+// Cells of the clock: 8 characters, digits and colons
+#define CLOCK_CELLS      8
+// Widest cell stored (glyph advance plus letter spacing, in columns)
+#define CLOCK_CELL_WIDTH 20
+// Pages covered by the clock rows
+#define CLOCK_FIRST_PAGE (CLOCK_Y / SH1106_DATA_SIZE)
+#define CLOCK_PAGES      ((CLOCK_Y + CLOCK_HEIGHT - 1) / SH1106_DATA_SIZE - CLOCK_FIRST_PAGE + 1)
+
+void CLOCK_Init(void);
+void CLOCK_Draw(int8_t hour, int8_t minute, int8_t second);
+void CLOCK_Invalidate(void);
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,24 @@
+#ifndef DMA2D_H_
+#define DMA2D_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+
+// Memory fill and copy for the display buffers (Src/dma2d.c)
+// The Chrom-ART accelerator moves the word-aligned part of a block as
+// 32-bit pixels (register to memory for a fill, memory to memory for a
+// copy) while the CPU writes the unaligned head and tail bytes. Blocks
+// smaller than DMA2D_MIN_SIZE, and every block on parts without DMA2D
+// (host build), are written by the CPU a word at a time.
+// The blocks must not be in a cacheable area while the data cache is on.
+
+#define DMA2D_MIN_SIZE  64      // Bytes below which the CPU is faster than a DMA2D setup
+#define DMA2D_MAX_WORDS 0x3FFFU // Pixels per line (NLR.PL), one line per transfer
+
+void DMA2D_Init(void);
+void DMA2D_Fill(void *destination, uint8_t value, uint32_t size);
+void DMA2D_Copy(void *destination, const void *source, uint32_t size);
+uint8_t DMA2D_Busy(void);
+void DMA2D_Wait(void);
+
+#endif /* DMA2D_H_ */
@@ -9,11 +9,24 @@
 #define DS3231_TIMEOUT_ERROR 1
 #define DS3231_SUCCESS 0
 
+// Control register: INT/SQW pin as a 1 Hz square wave (INTCN = 0, RS2:RS1 = 00)
+#define DS3231_REG_CONTROL     0x0E
+#define DS3231_CONTROL_INTCN   (1 << 2)
+#define DS3231_CONTROL_RS1     (1 << 3)
+#define DS3231_CONTROL_RS2     (1 << 4)
+
+// Called from the EXTI interrupt once per second: INT/SQW (open drain) on
+// PC6, EXTI line 6, falling edge at each new second
+typedef void (*DS3231_Callback)(void);
+
 void DS3231_Init(void);
 int DS3231_BcdToDec(unsigned char x);
 int DS3231_DecToBcd(unsigned char x);
 int DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint32_t timeout);
 int DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint32_t timeout);
+int DS3231_EnableSquareWave(uint32_t timeout);
+void DS3231_SetTickCallback(DS3231_Callback callback);
+void EXTI9_5_IRQHandler(void);
 
 
 #endif /* DS3231_H_ */
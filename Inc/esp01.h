@@ -11,10 +11,16 @@
 extern uint8_t ESP01_TXBuffer[ESP_BUF_SIZE];
 extern uint8_t ESP01_RXBuffer[ESP_BUF_SIZE];
 
+// Called from the DMA interrupt when the reception buffer is full
+typedef void (*ESP01_Callback)(void);
+
 void ESP01_Init(void);
+uint32_t ESP01_StartStep(void);
 void ESP01_UART_SendString(const char *str);
 void ESP01_UART_SendFormattedString(const char *format, ...);
 uint8_t ESP01_SendCommand(const char* cmd, const char* expected_response);
+uint8_t ESP01_GetReceivedData(uint8_t *buffer, uint16_t maxSize);
+void ESP01_SetReceiveCallback(ESP01_Callback callback);
 
 void ESP01_Transmit_DMA(const char *data);
 void UART7_IRQHandler(void);
@@ -0,0 +1,517 @@
+/*******************************************************************
+ * Rendering core shared by the display drivers
+ *
+ * Included once by each driver source (Src/sh1106.c, Src/st7920.c),
+ * never by application code. The driver defines its layout adapter
+ * first, then includes this file to get its drawing functions,
+ * compiled against that layout so that the pixel writes and spans
+ * are inlined without any function pointer:
+ *
+ *   GFX_NAME(name)   Public name of a function, e.g. SH1106_##name
+ *   GFX_WIDTH        Screen width (in pixels)
+ *   GFX_HEIGHT       Screen height (in pixels)
+ *   GFX_VERTICAL     1 if a buffer byte holds a column of 8 pixels
+ *                    (vertical spans are cheapest), 0 if it holds a
+ *                    row of 8 pixels (horizontal spans are cheapest)
+ *   GFX_COLOR_XOR    Color value inverting the pixels (0 clears them,
+ *                    1 sets them)
+ *
+ *   static inline void GFX_NAME(WritePixel)(uint8_t color, int16_t x, int16_t y);
+ *       Writes one pixel inside the screen
+ *   static void GFX_NAME(FillArea)(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+ *       Fills a rectangle, corners included, clipped to the screen
+ *   static void GFX_NAME(BlitGlyph)(uint8_t color, int16_t x, int16_t y, int16_t rows, const uint8_t *data, const FontGlyph *glyph);
+ *       Merges the stored part of a glyph fully inside the screen,
+ *       (x, y) being the top left corner of that part and rows its
+ *       height inside the font height
+ *   static void GFX_NAME(BlitStrip)(int16_t x, int16_t y, const uint8_t *strip, int16_t width, uint8_t mask, uint8_t mode);
+ *       Merges width column bytes of a decoded bitmap page (LSB at 
+ *       the top) with its top row at y, inside the screen 
+ *       horizontally but possibly crossing its top or bottom edge; 
+ *       only the rows in mask belong to the bitmap
+ *
+ * With GFX_COLOR_XOR a pixel drawn twice comes back to its original 
+ * value: every function below writes each pixel of its shape once.
+ *******************************************************************/
+
+#include "../Fonts/fonts.h"
+#include "../Bitmaps/bitmaps.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+/*******************************************************************
+ * @name       : GFX_SetPixel
+ * @brief      : Sets a pixel in the display buffer
+ * @details    : Sets or clears a pixel at the specified coordinates,
+ *               pixels outside the screen are ignored
+ * @parameters : color - Pixel color (1 = on, 0 = off, 2 = inverted)
+ *               x - Horizontal position (in pixels)
+ *               y - Vertical position (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(SetPixel)(uint8_t color, int16_t x, int16_t y)
+{
+	if (x >= GFX_WIDTH || y >= GFX_HEIGHT || x < 0 || y < 0) return;
+
+	GFX_NAME(WritePixel)(color, x, y);
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawCharacter
+ * @brief      : Draws a character in the buffer
+ * @details    : Draws a character at the specified coordinates using
+ *               the specified font. Glyphs fully inside the screen
+ *               are merged by the layout blit, clipped glyphs are
+ *               drawn pixel by pixel.
+ * @parameters : color - Text color (1 = on, 0 = off, 2 = inverted)
+ *               x - Starting horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               font - Font used to draw the text
+ *               letterNumberAscii - ASCII value of the character to draw
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawCharacter)(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii)
+{
+	const FontGlyph *glyph = FONT_GetGlyph(font, letterNumberAscii);
+	if (!glyph || !glyph->columns) return;
+
+	const uint8_t *data = &font->data[glyph->offset];
+	uint8_t byteCount = glyph->byteCount;
+	int16_t rows = font->height - 8 * glyph->firstByte;
+	if (rows > 8 * byteCount) rows = 8 * byteCount;
+
+	// Position of the stored part of the glyph
+	x += glyph->xOffset;
+	y += 8 * glyph->firstByte;
+
+	if (x >= 0 && y >= 0 && x + glyph->columns <= GFX_WIDTH && y + rows <= GFX_HEIGHT)
+	{
+		GFX_NAME(BlitGlyph)(color, x, y, rows, data, glyph);
+		return;
+	}
+
+	// Clipped glyphs are drawn pixel by pixel
+	for (int column = 0; column < glyph->columns; column++)
+	{
+		for (int byteColumn = 0; byteColumn < byteCount; byteColumn++)
+		{
+			uint8_t pixels = data[byteColumn + byteCount * column];
+			for (int bit = 0; bit < 8; bit++)
+			{
+				uint8_t pixel = (pixels >> bit) & 1;
+				int16_t a = x + column;
+				int16_t b = y + (bit + 8 * byteColumn);
+				if (pixel) GFX_NAME(SetPixel)(color, a, b);
+			}
+		}
+	}
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawStr
+ * @brief      : Draws a string in the buffer
+ * @details    : Draws a string starting from the specified
+ *               coordinates using the specified font
+ * @parameters : color - Text color (1 = on, 0 = off, 2 = inverted)
+ *               x - Starting horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               font - Font used to draw the text
+ *               format - String to be displayed
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawStr)(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format)
+{
+	while (*format && x < GFX_WIDTH && y < GFX_HEIGHT)
+	{
+		uint8_t currentChar = *format;
+		const FontGlyph *glyph = FONT_GetGlyph(font, currentChar);
+
+		if (glyph)
+		{
+			GFX_NAME(DrawCharacter)(color, x, y, font, currentChar);
+
+			// Create a space between the letters
+			x += glyph->advance + (font->length / 10);
+		}
+
+		// Go to next letter
+		format++;
+	}
+}
+
+/*******************************************************************
+ * @name       : GFX_FontPrint
+ * @brief      : Prints a formatted string in the buffer
+ * @details    : Draws a formatted string starting from the specified
+ *               coordinates using the specified font
+ * @parameters : color - Text color (1 = on, 0 = off, 2 = inverted)
+ *               x - Starting horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               font - Font used to draw the text
+ *               format - Formatted string to be displayed
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(FontPrint)(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	char formatted_string[50];
+	vsprintf(formatted_string, format, args);
+	va_end(args);
+
+	GFX_NAME(DrawStr)(color, x, y, font, formatted_string);
+}
+
+/*******************************************************************
+ * @name       : GFX_MeasureText
+ * @brief      : Measures a formatted string without drawing it
+ * @details    : Formats the string like GFX_FontPrint and adds the 
+ *               glyph advances, e.g. to center or right-align text 
+ *               before drawing it
+ * @parameters : font - Font used to draw the text
+ *               width - Returns the width of the string (in pixels)
+ *               height - Returns the height of the font (in pixels)
+ *               format - Formatted string to measure
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(MeasureText)(const Font *font, uint16_t *width, uint16_t *height, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	char formatted_string[50];
+	vsnprintf(formatted_string, sizeof(formatted_string), format, args);
+	va_end(args);
+
+	if (width) *width = FONT_TextWidth(font, formatted_string);
+	if (height) *height = font->height;
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawLine
+ * @brief      : Draws a line in the buffer
+ * @details    : Draws a line from (x0, y0) to (x1, y1)
+ * @parameters : color - Line color (1 = on, 0 = off, 2 = inverted)
+ *               x0 - Starting horizontal position (in pixels)
+ *               y0 - Starting vertical position (in pixels)
+ *               x1 - Ending horizontal position (in pixels)
+ *               y1 - Ending vertical position (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawLine)(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+	int dx = (x1 >= x0) ? x1 - x0 : x0 - x1;
+	int dy = (y1 >= y0) ? y1 - y0 : y0 - y1;
+	int sx = (x0 < x1) ? 1 : -1;
+	int sy = (y0 < y1) ? 1 : -1;
+	int err = dx - dy;
+
+	while(1)
+	{
+		GFX_NAME(SetPixel)(color, x0, y0);
+		if (x0 == x1 && y0 == y1) break;
+		int e2 = err + err;
+		if (e2 > -dy)
+		{
+			err -= dy;
+			x0 += sx;
+		}
+		if (e2 < dx)
+		{
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawHLine
+ * @brief      : Draws a horizontal line in the buffer
+ * @details    : Fills a one row high area
+ * @parameters : color - Line color (1 = on, 0 = off, 2 = inverted)
+ *               x - Starting horizontal position (in pixels)
+ *               y - Vertical position (in pixels)
+ *               w - Length of the line (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawHLine)(uint8_t color, int16_t x, int16_t y, int16_t w)
+{
+	GFX_NAME(FillArea)(color, x, y, x + w - 1, y);
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawVLine
+ * @brief      : Draws a vertical line in the buffer
+ * @details    : Fills a one column wide area
+ * @parameters : color - Line color (1 = on, 0 = off, 2 = inverted)
+ *               x - Horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               h - Length of the line (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawVLine)(uint8_t color, int16_t x, int16_t y, int16_t h)
+{
+	GFX_NAME(FillArea)(color, x, y, x, y + h - 1);
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawRectangle
+ * @brief      : Draws a rectangle in the buffer
+ * @details    : Draws a rectangle with the specified width and
+ *               height starting from the specified coordinates
+ * @parameters : color - Rectangle color (1 = on, 0 = off, 2 = inverted)
+ *               x - Starting horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               w - Width of the rectangle (in pixels)
+ *               h - Height of the rectangle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawRectangle)(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	// Check input parameters
+	if (x >= GFX_WIDTH || y >= GFX_HEIGHT) return;
+
+	// Check width and height
+	if ((x + w) >= GFX_WIDTH) w = GFX_WIDTH - x;
+	if ((y + h) >= GFX_HEIGHT) h = GFX_HEIGHT - y;
+
+	// Draw 4 lines, the sides between the top and bottom lines
+	GFX_NAME(DrawHLine)(color, x, y, w + 1);                         // Top line
+	if (h > 0) GFX_NAME(DrawHLine)(color, x, y + h, w + 1);          // Bottom line
+	if (h > 1)
+	{
+		GFX_NAME(DrawVLine)(color, x, y + 1, h - 1);                 // Left line
+		if (w > 0) GFX_NAME(DrawVLine)(color, x + w, y + 1, h - 1);  // Right line
+	}
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawFilledRectangle
+ * @brief      : Draws a filled rectangle in the buffer
+ * @details    : Draws a filled rectangle with the specified
+ *               width and height starting from the specified
+ *               coordinates
+ * @parameters : color - Rectangle color (1 = on, 0 = off, 2 = inverted)
+ *               x - Starting horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               w - Width of the rectangle (in pixels)
+ *               h - Height of the rectangle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawFilledRectangle)(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	// Check input parameters
+	if (x >= GFX_WIDTH || y >= GFX_HEIGHT) return;
+
+	// Check width and height
+	if ((x + w) >= GFX_WIDTH) w = GFX_WIDTH - x;
+	if ((y + h) >= GFX_HEIGHT) h = GFX_HEIGHT - y;
+
+	GFX_NAME(FillArea)(color, x, y, x + w, y + h);
+}
+
+/*******************************************************************
+ * @name       : GFX_PlotOctants
+ * @brief      : Plots the symmetric points of a circle
+ * @details    : Plots (x, y) in the 8 octants around the center, 
+ *               once each: on the axes (y = 0) and on the diagonals 
+ *               (x = y) the octants share their points
+ * @parameters : color - Pixel color (1 = on, 0 = off, 2 = inverted)
+ *               x0 - Horizontal center position (in pixels)
+ *               y0 - Vertical center position (in pixels)
+ *               x - Offset along the first octant (x >= y)
+ *               y - Offset across the first octant
+ * @return     : None
+ *******************************************************************/
+static void GFX_NAME(PlotOctants)(uint8_t color, int16_t x0, int16_t y0, int16_t x, int16_t y)
+{
+	if (y == 0)
+	{
+		GFX_NAME(SetPixel)(color, x0 + x, y0);
+		if (x == 0) return;
+		GFX_NAME(SetPixel)(color, x0 - x, y0);
+		GFX_NAME(SetPixel)(color, x0, y0 + x);
+		GFX_NAME(SetPixel)(color, x0, y0 - x);
+		return;
+	}
+
+	GFX_NAME(SetPixel)(color, x0 + x, y0 + y);
+	GFX_NAME(SetPixel)(color, x0 - x, y0 + y);
+	GFX_NAME(SetPixel)(color, x0 + x, y0 - y);
+	GFX_NAME(SetPixel)(color, x0 - x, y0 - y);
+	if (x == y) return;
+
+	GFX_NAME(SetPixel)(color, x0 + y, y0 + x);
+	GFX_NAME(SetPixel)(color, x0 - y, y0 + x);
+	GFX_NAME(SetPixel)(color, x0 + y, y0 - x);
+	GFX_NAME(SetPixel)(color, x0 - y, y0 - x);
+}
+
+/*******************************************************************
+ * @name       : GFX_InvertRegion
+ * @brief      : Inverts a rectangle of the buffer
+ * @details    : Flips the pixels in place, whole bytes at a time, 
+ *               e.g. to highlight a selection; inverting again 
+ *               restores the rectangle
+ * @parameters : x - Starting horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               w - Width of the rectangle (in pixels)
+ *               h - Height of the rectangle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(InvertRegion)(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	if (w <= 0 || h <= 0) return;
+
+	GFX_NAME(FillArea)(GFX_COLOR_XOR, x, y, x + w - 1, y + h - 1);
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawCircle
+ * @brief      : Draws a circle in the buffer
+ * @details    : Draws a circle with the specified radius centered
+ *               at (x0, y0)
+ * @parameters : color - Circle color (1 = on, 0 = off, 2 = inverted)
+ *               x0 - Horizontal center position (in pixels)
+ *               y0 - Vertical center position (in pixels)
+ *               radius - Radius of the circle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawCircle)(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
+{
+	int x = radius;
+	int y = 0;
+	int err = 0;
+
+	while (x >= y)
+	{
+		GFX_NAME(PlotOctants)(color, x0, y0, x, y);
+
+		y++;
+		err += 1 + 2*y;
+
+		if (2*(err - x) + 1 > 0)
+		{
+			x--;
+			err += 1 - 2*x;
+		}
+	}
+}
+
+/*******************************************************************
+ * @name       : GFX_FillSpans
+ * @brief      : Fills the two symmetric spans of a filled circle
+ * @details    : Spans along the bytes of the layout: columns at 
+ *               x0 - offset and x0 + offset, or rows at y0 - offset 
+ *               and y0 + offset, one span when offset is 0
+ * @parameters : color - Circle color (1 = on, 0 = off, 2 = inverted)
+ *               x0 - Horizontal center position (in pixels)
+ *               y0 - Vertical center position (in pixels)
+ *               offset - Distance of the spans from the center
+ *               half - Half length of the spans
+ * @return     : None
+ *******************************************************************/
+static void GFX_NAME(FillSpans)(uint8_t color, int16_t x0, int16_t y0, int16_t offset, int16_t half)
+{
+#if GFX_VERTICAL
+	GFX_NAME(DrawVLine)(color, x0 + offset, y0 - half, 2 * half + 1);
+	if (offset) GFX_NAME(DrawVLine)(color, x0 - offset, y0 - half, 2 * half + 1);
+#else
+	GFX_NAME(DrawHLine)(color, x0 - half, y0 + offset, 2 * half + 1);
+	if (offset) GFX_NAME(DrawHLine)(color, x0 - half, y0 - offset, 2 * half + 1);
+#endif
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawFilledCircle
+ * @brief      : Draws a filled circle in the buffer
+ * @details    : Draws a filled circle with the specified radius
+ *               centered at (x0, y0), with spans along the bytes
+ *               of the layout
+ * @parameters : color - Circle color (1 = on, 0 = off, 2 = inverted)
+ *               x0 - Horizontal center position (in pixels)
+ *               y0 - Vertical center position (in pixels)
+ *               r - Radius of the circle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawFilledCircle)(uint8_t color, int16_t x0, int16_t y0, int16_t r)
+{
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+	int16_t px = x;
+	int16_t py = y;
+
+	GFX_NAME(FillSpans)(color, x0, y0, 0, r);
+
+	while (x < y)
+	{
+		if (f >= 0)
+		{
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+
+		GFX_NAME(FillSpans)(color, x0, y0, x, y);
+
+		// The spans at offset y are complete once y moves, with the 
+		// last x as half length; offsets already drawn as x are skipped
+		if (y != py)
+		{
+			if (py > x) GFX_NAME(FillSpans)(color, x0, y0, py, px);
+			py = y;
+		}
+		px = x;
+	}
+
+	if (py > px) GFX_NAME(FillSpans)(color, x0, y0, py, px);
+}
+
+/*******************************************************************
+ * @name       : GFX_DrawBitmap
+ * @brief      : Draws a bitmap in the buffer
+ * @details    : Decodes the runs of the bitmap one page at a time 
+ *               into a strip of column bytes and merges the strip 
+ *               into the buffer byte by byte, clipped to the screen
+ * @parameters : x - Left position (in pixels)
+ *               y - Top position (in pixels)
+ *               bitmap - Run-length encoded bitmap
+ *               mode - BITMAP_OPAQUE, BITMAP_TRANSPARENT or BITMAP_XOR, 
+ *                      with BITMAP_INVERT to invert the bitmap pixels
+ * @return     : None
+ *******************************************************************/
+void GFX_NAME(DrawBitmap)(int16_t x, int16_t y, const Bitmap *bitmap, uint8_t mode)
+{
+	uint8_t strip[256];
+	const uint8_t *stream = bitmap->data;
+	uint8_t pages = (bitmap->height + 7) / 8;
+
+	// Columns inside the screen
+	int16_t first = (x < 0) ? -x : 0;
+	int16_t last = (x + bitmap->width > GFX_WIDTH) ? GFX_WIDTH - x - 1 : bitmap->width - 1;
+	if (first > last) return;
+
+	for (uint8_t page = 0; page < pages; page++)
+	{
+		int16_t top = y + 8 * page;
+		if (top >= GFX_HEIGHT) break;
+
+		// Pages are decoded in order, even above the screen
+		stream = BITMAP_DecodePage(stream, strip, bitmap->width);
+		if (top + 8 <= 0) continue;
+
+		uint8_t mask = 0xFF;
+		if (page == pages - 1 && bitmap->height % 8) mask >>= 8 - bitmap->height % 8;
+
+		if (mode & BITMAP_INVERT)
+			for (int16_t column = first; column <= last; column++) strip[column] = ~strip[column];
+
+		GFX_NAME(BlitStrip)(x + first, top, &strip[first], last - first + 1, mask, mode);
+	}
+}
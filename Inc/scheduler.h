@@ -0,0 +1,30 @@
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+#include "timer.h"
+
+// Cooperative run-to-completion scheduler (Src/scheduler.c)
+// A task is a function that returns quickly. It runs when it is posted
+// (from an interrupt or another task) or when its period expires, a
+// software timer (Inc/timer.h) posting it; ready tasks run in the order
+// they were added. The core sleeps (WFI) when no task is ready, SysTick
+// (Inc/tim.h) wakes it every millisecond to advance the timers.
+
+#define SCHEDULER_MAX_TASKS 8
+
+typedef void (*SCHEDULER_Task)(void);
+
+// Scheduler counters
+typedef struct {
+	uint32_t runs;    // Tasks run
+	uint32_t sleeps;  // WFI executed with no task ready
+} SCHEDULER_StatsTypeDef;
+
+uint8_t SCHEDULER_Add(SCHEDULER_Task task, uint32_t period);
+void SCHEDULER_Post(uint8_t id);
+void SCHEDULER_Run(void);
+const SCHEDULER_StatsTypeDef *SCHEDULER_GetStats(void);
+
+#endif /* SCHEDULER_H_ */
@@ -0,0 +1,24 @@
+#ifndef SCREEN_H_
+#define SCREEN_H_
+
+#include <stm32f7xx.h>
+
+// Date and time shown on the main screen
+typedef struct
+{
+	float temperature; // DS3231 temperature (in degrees Celsius)
+	int8_t second;
+	int8_t minute;
+	int8_t hour;
+	int8_t dayWeek;    // 1 (Monday) to 7 (Sunday)
+	int8_t dayMonth;
+	int8_t month;      // 1 (January) to 12 (December)
+	int8_t year;       // Year in the century
+	int8_t century;
+} SCREEN_DateTypeDef;
+
+void SCREEN_Date(const SCREEN_DateTypeDef *date);
+void SCREEN_Error(const char *message);
+void SCREEN_Setting(const char *format, ...);
+
+#endif /* SCREEN_H_ */
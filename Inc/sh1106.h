@@ -5,27 +5,28 @@
 #include <stm32f7xx.h>
 
 #include "../Fonts/fonts.h"
+#include "../Bitmaps/bitmaps.h"
 
-//Pins activated/desactivated
-#define SH1106_DC_LOW (GPIOA->BSRR=GPIO_BSRR_BR0)
-#define SH1106_DC_HIGH (GPIOA->BSRR=GPIO_BSRR_BS0)
-
-#define SH1106_CS_LOW (GPIOC->BSRR=GPIO_BSRR_BR1)
-#define SH1106_CS_HIGH (GPIOC->BSRR=GPIO_BSRR_BS1)
-
-#define SH1106_RST_LOW (GPIOC->BSRR=GPIO_BSRR_BR0)
-#define SH1106_RST_HIGH (GPIOC->BSRR=GPIO_BSRR_BS0)
-
-// SPI1_AF in alternate fonction
-#define SH1106_SPI1_AF 0x05 
+// DMA transfer phases
+#define SH1106_PHASE_CMD  0
+#define SH1106_PHASE_DATA 1
 
 // Timeout
 #define SH1106_TIMEOUT 1000
 
+// Power-up time before the screen configuration (milliseconds)
+#define SH1106_POWER_UP_DELAY 200
+
 // Screen dimensions
 #define SH1106_WIDTH     (uint16_t) 132
 #define SH1106_HEIGHT    (uint8_t) 64
 #define SH1106_DATA_SIZE (uint8_t) 8
+#define SH1106_PAGES     (uint8_t) (SH1106_HEIGHT/SH1106_DATA_SIZE)
+
+// Colors of the drawing functions
+#define SH1106_COLOR_OFF 0
+#define SH1106_COLOR_ON  1
+#define SH1106_COLOR_XOR 2 // Inverts the pixels drawn
 
 // SH1106 command definitions 
 #define SH1106_CMD_COL_LOW      (uint8_t) 0x00 // Set Lower Column Address
@@ -61,16 +62,49 @@
 #define XLevelH                 (uint8_t) 0x10
 #define YLevel                  (uint8_t) 0xB0
 
+typedef void (*SH1106_Callback)(void);
+
+// Transfer counters
+typedef struct {
+	uint16_t bytesSent;    // Data bytes sent for the last frame
+	uint16_t commandsSent; // Command bytes sent for the last frame
+	uint8_t windowsSent;   // Column windows sent for the last frame
+	uint32_t totalBytes;   // Data and command bytes sent since initialization
+	uint32_t frames;       // Frames sent since initialization
+} SH1106_StatsTypeDef;
+
+uint32_t SH1106_InitStep(void);
 void SH1106_Init(void);
+uint8_t SH1106_IsReady(void);
 void SH1106_SetPixel(uint8_t pixel, int16_t x, int16_t y);
 void SH1106_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumber);
+void SH1106_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format);
 void SH1106_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...);
+void SH1106_MeasureText(const Font *font, uint16_t *width, uint16_t *height, const char *format, ...);
 void SH1106_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void SH1106_DrawHLine(uint8_t color, int16_t x, int16_t y, int16_t w);
+void SH1106_DrawVLine(uint8_t color, int16_t x, int16_t y, int16_t h);
 void SH1106_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void SH1106_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void SH1106_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r);
 void SH1106_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius);
+void SH1106_InvertRegion(int16_t x, int16_t y, int16_t w, int16_t h);
+void SH1106_DrawBitmap(int16_t x, int16_t y, const Bitmap *bitmap, uint8_t mode);
+void SH1106_CopyPages(int16_t x, uint8_t page, uint8_t width, uint8_t pages, const uint8_t *data, uint16_t stride, const uint8_t *masks);
 void SH1106_ClearBuffer(void);
+void SH1106_FillBuffer(uint8_t color);
+void SH1106_CopyBuffer(const uint8_t *frame);
 void SH1106_SendBuffer(void);
+void SH1106_SendPage(uint8_t page, const uint8_t *data);
+void SH1106_Invalidate(void);
+void SH1106_SetStartLine(uint8_t line);
+void SH1106_Scroll(int8_t lines);
+uint8_t SH1106_GetStartLine(void);
+void SH1106_SetOffset(uint8_t offset);
+void SH1106_SetDoubleBuffer(uint8_t enable);
+const SH1106_StatsTypeDef *SH1106_GetStats(void);
+uint8_t SH1106_IsBusy(void);
+void SH1106_WaitTransfer(void);
+void SH1106_SetTransferCallback(SH1106_Callback callback);
 
 #endif /* SH1106_H_ */
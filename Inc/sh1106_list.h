@@ -0,0 +1,30 @@
+#ifndef SH1106_LIST_H_
+#define SH1106_LIST_H_
+
+#include <stm32f7xx.h>
+#include "sh1106.h"
+
+// Capacity of the display list
+#define SH1106_LIST_SIZE      32  // Commands
+#define SH1106_LIST_TEXT_SIZE 128 // Characters of all the strings, terminators included
+
+// Display list counters
+typedef struct {
+	uint16_t commands;  // Commands recorded since SH1106_LIST_Begin
+	uint16_t dropped;   // Commands lost because the list or the text pool was full
+	uint16_t replayed;  // Commands rasterized by the last render, summed over the pages
+	uint16_t culled;    // Commands skipped by the last render, summed over the pages
+} SH1106_LIST_StatsTypeDef;
+
+void SH1106_LIST_Begin(void);
+void SH1106_LIST_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...);
+void SH1106_LIST_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void SH1106_LIST_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void SH1106_LIST_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void SH1106_LIST_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius);
+void SH1106_LIST_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r);
+void SH1106_LIST_DrawBitmap(int16_t x, int16_t y, const Bitmap *bitmap, uint8_t mode);
+void SH1106_LIST_Render(void);
+const SH1106_LIST_StatsTypeDef *SH1106_LIST_GetStats(void);
+
+#endif /* SH1106_LIST_H_ */
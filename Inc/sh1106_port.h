@@ -0,0 +1,44 @@
+#ifndef SH1106_PORT_H_
+#define SH1106_PORT_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+
+// Transport of the SH1106 driver: SPI1 and DMA2 on the board (Src/sh1106_port.c),
+// a simulated controller in the host build (Host/Src/sh1106_port_host.c)
+
+//Pins activated/desactivated
+#define SH1106_DC_LOW (GPIOA->BSRR=GPIO_BSRR_BR0)
+#define SH1106_DC_HIGH (GPIOA->BSRR=GPIO_BSRR_BS0)
+
+#define SH1106_CS_LOW (GPIOC->BSRR=GPIO_BSRR_BR1)
+#define SH1106_CS_HIGH (GPIOC->BSRR=GPIO_BSRR_BS1)
+
+#define SH1106_RST_LOW (GPIOC->BSRR=GPIO_BSRR_BR0)
+#define SH1106_RST_HIGH (GPIOC->BSRR=GPIO_BSRR_BS0)
+
+// SPI1_AF in alternate fonction
+#define SH1106_SPI1_AF 0x05 
+
+// DMA2 Stream3 Channel3 is SPI1_TX
+#define SH1106_DMA_STREAM  DMA2_Stream3
+#define SH1106_DMA_CHANNEL 3U
+
+// Byte modes (DC pin)
+#define SH1106_PORT_CMD  0
+#define SH1106_PORT_DATA 1
+
+void SH1106_PORT_Init(void);
+uint32_t SH1106_PORT_ResetStep(void);
+void SH1106_PORT_SendCmd(uint8_t cmd);
+void SH1106_PORT_Begin(uint8_t mode);
+void SH1106_PORT_SetMode(uint8_t mode);
+void SH1106_PORT_Stream(const uint8_t *data, uint16_t size);
+void SH1106_PORT_End(void);
+void SH1106_PORT_Release(void);
+void DMA2_Stream3_IRQHandler(void);
+
+// Called by the port once a stream has left the SPI (error = 1 if aborted)
+void SH1106_StreamComplete(uint8_t error);
+
+#endif /* SH1106_PORT_H_ */
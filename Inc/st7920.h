@@ -5,23 +5,26 @@
 #include <stm32f7xx.h>
 
 #include "../Fonts/fonts.h"
-
-//Pins activated/desactivated
-#define ST7920_CS_LOW (GPIOC->BSRR=GPIO_BSRR_BR1)
-#define ST7920_CS_HIGH (GPIOC->BSRR=GPIO_BSRR_BS1)
-
-#define ST7920_RST_LOW (GPIOC->BSRR=GPIO_BSRR_BR0)
-#define ST7920_RST_HIGH (GPIOC->BSRR=GPIO_BSRR_BS0)
-
-// SPI1_AF in alternate fonction
-#define ST7920_SPI1_AF 0x05 
+#include "../Bitmaps/bitmaps.h"
 
 // Screen dimensions
 #define ST7920_WIDTH     (uint8_t) 128
 #define ST7920_HEIGHT    (uint8_t) 64
 #define ST7920_DATA_SIZE (uint8_t) 8
 
-static uint8_t Graphic_Check = 0;
+// Colors of the drawing functions
+#define ST7920_COLOR_OFF 0
+#define ST7920_COLOR_ON  1
+#define ST7920_COLOR_XOR 2 // Inverts the pixels drawn
+
+// Execution time of the instructions and data writes (fosc = 540 kHz):
+// the busy flag cannot be read over the serial link, frames are paced
+#define ST7920_EXEC_US 72
+#define ST7920_CLS_US  1600
+
+// Text overlay (8x16 ROM characters)
+#define ST7920_TEXT_ROWS    4
+#define ST7920_TEXT_COLUMNS 16
 
 // ST7920 command definitions 
 #define ST7920_CMD              (uint8_t) 0xF8 // Command mode
@@ -66,20 +69,28 @@ static uint8_t Graphic_Check = 0;
 #define ST7920_CMD_REVERSE_LINE2 (uint8_t) 0x26 // Reverse display of the third line
 #define ST7920_CMD_REVERSE_LINE3 (uint8_t) 0x27 // Reverse display of the fourth line
 
-// Buffer for display data
-static uint8_t ST7920_Buffer[(ST7920_WIDTH * ST7920_HEIGHT) / ST7920_DATA_SIZE];
-
+uint32_t ST7920_InitStep(void);
 void ST7920_Init(void);
 void ST7920_GraphicMode(int enable);
 void ST7920_SetPixel(uint8_t pixel, int16_t x, int16_t y);
 void ST7920_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumber);
 void ST7920_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...);
+void ST7920_MeasureText(const Font *font, uint16_t *width, uint16_t *height, const char *format, ...);
 void ST7920_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void ST7920_DrawHLine(uint8_t color, int16_t x, int16_t y, int16_t w);
+void ST7920_DrawVLine(uint8_t color, int16_t x, int16_t y, int16_t h);
 void ST7920_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void ST7920_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void ST7920_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r);
 void ST7920_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius);
+void ST7920_InvertRegion(int16_t x, int16_t y, int16_t w, int16_t h);
+void ST7920_DrawBitmap(int16_t x, int16_t y, const Bitmap *bitmap, uint8_t mode);
 void ST7920_ClearBuffer(void);
+void ST7920_FillBuffer(uint8_t color);
+void ST7920_CopyBuffer(const uint8_t *frame);
 void ST7920_SendBuffer(void);
+void ST7920_Invalidate(void);
+void ST7920_TextPrint(uint8_t row, uint8_t column, const char *format, ...);
+void ST7920_TextClear(void);
 
 #endif /* ST7920_H_ */
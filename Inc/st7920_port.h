@@ -0,0 +1,31 @@
+#ifndef ST7920_PORT_H_
+#define ST7920_PORT_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+
+// Transport of the ST7920 driver: serial bytes on SPI1 on the board (Src/st7920_port.c),
+// a simulated controller in the host build (Host/Src/st7920_port_host.c)
+
+//Pins activated/desactivated
+#define ST7920_CS_LOW (GPIOC->BSRR=GPIO_BSRR_BR1)
+#define ST7920_CS_HIGH (GPIOC->BSRR=GPIO_BSRR_BS1)
+
+#define ST7920_RST_LOW (GPIOC->BSRR=GPIO_BSRR_BR0)
+#define ST7920_RST_HIGH (GPIOC->BSRR=GPIO_BSRR_BS0)
+
+// SPI1_AF in alternate fonction
+#define ST7920_SPI1_AF 0x05
+
+// Serial clock: PCLK2 (16 MHz) / 16 = 1 MHz, a 1 us SCLK cycle for a 400 ns
+// minimum. A frame spends 24 us on the wire, well inside ST7920_EXEC_US.
+#define ST7920_SPI_BR (SPI_CR1_BR_1 | SPI_CR1_BR_0)
+#define ST7920_SCK_HZ 1000000
+
+void ST7920_PORT_Init(void);
+void ST7920_PORT_Reset(uint8_t active);
+void ST7920_PORT_Select(void);
+void ST7920_PORT_Write(uint8_t byte);
+void ST7920_PORT_Deselect(void);
+
+#endif /* ST7920_PORT_H_ */
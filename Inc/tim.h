@@ -3,23 +3,21 @@
 
 #include <stm32f7xx.h>
 
+// Monotonic time base, started once by TIM_Init:
+// - SysTick counts milliseconds (software timers, scheduler),
+// - TIM2 (32-bit) runs free at 1 MHz (short delays and timeouts).
+// Both counters wrap around: compare instants with a difference,
+// (uint32_t)(now - start) >= duration, never with < or >.
+
 // Prescalers based on SystemCoreClock
 #define TIM_PSC_MICROSECONDS ((SystemCoreClock / 1000000) - 1) // Prescaler for microseconds (1 us per tick)
-#define TIM_PSC_MILLISECONDS ((SystemCoreClock / 1000) - 1)    // Prescaler for milliseconds (1 ms per tick)
-
-// Timer 1 and Timer 2 function prototypes
-void TIM1_InitForDelay(void);           // Initialize Timer 1 for delay purposes
-void TIM1_WaitMicroseconds(unsigned int us);  // Wait for a specific number of microseconds using Timer 1
-void TIM1_WaitMilliseconds(unsigned int ms);  // Wait for a specific number of milliseconds using Timer 1
+#define TIM_TICK_HZ          1000                             // SysTick rate (1 ms per tick)
 
-void TIM2_Init(void);  // Initialize Timer 2 for general purposes
-void TIM2_SetTimer(uint32_t timeout);
-void TIM2_StartTimer(void);
-void TIM2_StopTimer(void);
-void TIM2_ResetCounter(void);
-uint32_t TIM2_GetCounterValue(void);
-uint32_t TIM2_TimeoutFlag(void);
-void TIM2_ResetTimeoutFlag(void);
-	
+void TIM_Init(void);                         // Start SysTick and TIM2
+uint32_t TIM_GetMilliseconds(void);          // Milliseconds since TIM_Init (wraps after 49 days)
+uint32_t TIM_GetMicroseconds(void);          // Microseconds since TIM_Init (wraps after 71 minutes)
+void TIM_WaitMicroseconds(uint32_t us);      // Busy wait on TIM2
+void TIM_WaitMilliseconds(uint32_t ms);      // Busy wait on TIM2
+void SysTick_Handler(void);
 
 #endif // TIM_H
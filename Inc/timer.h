@@ -0,0 +1,37 @@
+#ifndef TIMER_H_
+#define TIMER_H_
+
+#include <stdint.h>
+
+// Software timers on a hierarchical timing wheel (Src/timer.c)
+// Timers count the milliseconds of TIM_GetMilliseconds. A timer lives in
+// the slot of its expiry: level 0 holds the next 256 ms one slot per
+// millisecond, each upper level covers 64 times the span of the level
+// below. A tick runs one slot of level 0 and, every 256 ticks, moves one
+// slot of the upper levels down, so starting, stopping and expiring are
+// O(1) whatever the number of timers. Callbacks run from TIMER_Process
+// (the scheduler loop), never from an interrupt.
+
+#define TIMER_LEVEL0_BITS 8
+#define TIMER_LEVEL_BITS  6
+#define TIMER_LEVELS      4   // Delays up to 2^26 ms (18 hours), longer ones are reconsidered
+
+typedef struct TIMER_TypeDef TIMER_TypeDef;
+typedef void (*TIMER_Callback)(void *context);
+
+// Timer, owned by the caller; only the wheel writes its fields
+struct TIMER_TypeDef {
+	TIMER_TypeDef *next;
+	TIMER_TypeDef **link;     // Pointer to this timer in its slot, 0 when stopped
+	uint32_t expires;         // Millisecond of the next run
+	uint32_t period;          // Milliseconds between two runs, 0 for a one-shot timer
+	TIMER_Callback callback;
+	void *context;
+};
+
+void TIMER_Start(TIMER_TypeDef *timer, uint32_t delay, uint32_t period, TIMER_Callback callback, void *context);
+void TIMER_Stop(TIMER_TypeDef *timer);
+uint8_t TIMER_IsActive(const TIMER_TypeDef *timer);
+void TIMER_Process(uint32_t now);
+
+#endif /* TIMER_H_ */
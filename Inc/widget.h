@@ -0,0 +1,28 @@
+#ifndef WIDGET_H_
+#define WIDGET_H_
+
+#include <stm32f7xx.h>
+#include "../Fonts/fonts.h"
+
+#define WIDGET_TEXT_SIZE 32
+
+// Retained text widget: a screen rectangle and the last string drawn in it
+typedef struct
+{
+	int16_t x;                    // Left edge of the rectangle and the text (in pixels)
+	int16_t y;                    // Top edge of the rectangle and the text (in pixels)
+	uint8_t width;                // Width of the rectangle (in pixels)
+	uint8_t height;               // Height of the rectangle (in pixels)
+	const Font *font;             // Font used to draw the text
+	uint8_t valid;                // Set once text has been drawn in the buffer
+	char text[WIDGET_TEXT_SIZE];  // Last string drawn
+} WIDGET_TextTypeDef;
+
+// Static initializer for a text widget
+#define WIDGET_TEXT(x, y, width, height, font) {(x), (y), (width), (height), (font), 0, {0}}
+
+uint8_t WIDGET_Print(WIDGET_TextTypeDef *widget, const char *format, ...);
+void WIDGET_Clear(WIDGET_TextTypeDef *widget);
+void WIDGET_Invalidate(WIDGET_TextTypeDef *widget);
+
+#endif /* WIDGET_H_ */
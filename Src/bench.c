@@ -0,0 +1,230 @@
+#include "../Inc/bench.h"
+#include "../Inc/sh1106.h"
+#include "../Inc/clock.h"
+
+#ifndef BENCH_HOST
+#include "../Inc/usart.h"
+#endif
+
+#include <stdarg.h>
+#include <stdio.h>
+
+typedef void (*BENCH_Function)(int argument);
+
+static uint32_t BENCH_Overhead = 0;
+
+// Operations under test
+static const Font *BENCH_Font;
+
+static void BENCH_Character(int ascii) { SH1106_DrawCharacter(1, 10, 10, BENCH_Font, ascii); }
+static void BENCH_String(int index);
+static void BENCH_Line(int slope);
+static void BENCH_TextWidth(int index);
+static void BENCH_Circle(int radius) { SH1106_DrawCircle(1, 63, 31, radius); }
+static void BENCH_FilledCircle(int radius) { SH1106_DrawFilledCircle(1, 63, 31, radius); }
+static void BENCH_Clear(int unused) { (void)unused; SH1106_ClearBuffer(); }
+static void BENCH_Fill(int unused) { (void)unused; SH1106_DrawFilledRectangle(1, 0, 0, SH1106_WIDTH, SH1106_HEIGHT); }
+static void BENCH_Invalidate(int unused) { (void)unused; SH1106_Invalidate(); }
+static void BENCH_Invert(int height) { SH1106_InvertRegion(0, SH1106_HEIGHT - height, SH1106_WIDTH, height); }
+static void BENCH_Bitmap(int mode) { SH1106_DrawBitmap(10, 10, &IconAlarm, mode); }
+static void BENCH_BitmapAligned(int mode) { SH1106_DrawBitmap(10, 8, &IconAlarm, mode); }
+static void BENCH_Time(int second) { CLOCK_Draw(23, 59, second); }
+static void BENCH_TimeReset(int second) { SH1106_ClearBuffer(); CLOCK_Invalidate(); CLOCK_Draw(23, 59, second - 1); }
+static void BENCH_TimeClear(int unused) { (void)unused; SH1106_ClearBuffer(); CLOCK_Invalidate(); }
+static void BENCH_Send(int unused)
+{
+	(void)unused;
+	SH1106_SendBuffer();
+	SH1106_WaitTransfer();
+}
+
+// Strings of the main screen
+typedef struct {
+	const Font *font;
+	int16_t x;
+	int16_t y;
+	const char *text;
+} BENCH_StringTypeDef;
+
+static const BENCH_StringTypeDef BENCH_Strings[] = {
+	{&Arial12x12, 0, 0, "Temp: 24.50"},
+	{&Arial28x28, 7, 13, "23:59:59"},
+	{&Arial12x12, 0, 39, "Wednesday,"},
+	{&Arial12x12, 0, 52, "September 30, 2099"},
+};
+
+static void BENCH_String(int index)
+{
+	const BENCH_StringTypeDef *string = &BENCH_Strings[index];
+	SH1106_FontPrint(1, string->x, string->y, string->font, "%s", string->text);
+}
+
+static void BENCH_TextWidth(int index)
+{
+	const BENCH_StringTypeDef *string = &BENCH_Strings[index];
+	uint16_t width, height;
+	SH1106_MeasureText(string->font, &width, &height, "%s", string->text);
+}
+
+// Lines from the top left corner, from horizontal to vertical
+static const uint8_t BENCH_LineEnd[][2] = {{127, 0}, {127, 16}, {63, 63}, {16, 63}, {0, 63}};
+static const char *const BENCH_LineName[] = {"horizontal", "1:8", "1:1", "8:1", "vertical"};
+
+static void BENCH_Line(int slope)
+{
+	SH1106_DrawLine(1, 0, 0, BENCH_LineEnd[slope][0], BENCH_LineEnd[slope][1]);
+}
+
+/*******************************************************************
+ * @name       : BENCH_Measure
+ * @brief      : Times an operation
+ * @details    : Runs the untimed setup then the operation, 
+ *               BENCH_ITERATIONS times, and returns the mean time of 
+ *               the operation minus the clock read overhead
+ * @parameters : function - Operation to time
+ *               setup - Operation run before each iteration (or 0)
+ *               argument - Argument of both
+ * @return     : Mean time per operation (in BENCH_Unit)
+ *******************************************************************/
+static uint32_t BENCH_Measure(BENCH_Function function, BENCH_Function setup, int argument)
+{
+	uint32_t total = 0;
+
+	for (int i = 0; i < BENCH_ITERATIONS; i++)
+	{
+		if (setup) setup(argument);
+		uint32_t start = BENCH_Clock();
+		function(argument);
+		uint32_t time = BENCH_Clock() - start;
+		total += (time > BENCH_Overhead) ? time - BENCH_Overhead : 0;
+	}
+
+	return total / BENCH_ITERATIONS;
+}
+
+static void BENCH_Row(const char *operation, const char *case_, BENCH_Function function, BENCH_Function setup, int argument)
+{
+	BENCH_Print("%-18s %-20s %10lu\r\n", operation, case_, (unsigned long)BENCH_Measure(function, setup, argument));
+}
+
+/*******************************************************************
+ * @name       : BENCH_Run
+ * @brief      : Runs the rendering benchmarks
+ * @details    : Prints one line per operation and case with its mean 
+ *               time, then leaves the buffer and the screen cleared
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void BENCH_Run(void)
+{
+	static const Font *const fonts[] = {&Arial12x12, &Arial28x28};
+	static const char *const fontNames[] = {"Arial12x12", "Arial28x28"};
+	static const uint8_t radii[] = {4, 12, 31};
+	char case_[24];
+
+	BENCH_ClockInit();
+
+	// Cost of two back to back clock reads
+	BENCH_Overhead = 0xFFFFFFFF;
+	for (int i = 0; i < BENCH_ITERATIONS; i++)
+	{
+		uint32_t start = BENCH_Clock();
+		uint32_t time = BENCH_Clock() - start;
+		if (time < BENCH_Overhead) BENCH_Overhead = time;
+	}
+
+	BENCH_Print("%-18s %-20s %10s\r\n", "operation", "case", BENCH_Unit);
+
+	for (int f = 0; f < 2; f++)
+	{
+		BENCH_Font = fonts[f];
+		for (int ascii = fonts[f]->asciiBegin; ascii < fonts[f]->asciiEnd; ascii++)
+		{
+			snprintf(case_, sizeof(case_), "%s '%c'", fontNames[f], ascii);
+			BENCH_Row("DrawCharacter", case_, BENCH_Character, BENCH_Clear, ascii);
+		}
+	}
+
+	for (int n = 0; n < (int)(sizeof(BENCH_Strings) / sizeof(BENCH_Strings[0])); n++)
+		BENCH_Row("FontPrint", BENCH_Strings[n].text, BENCH_String, BENCH_Clear, n);
+	for (int n = 0; n < (int)(sizeof(BENCH_Strings) / sizeof(BENCH_Strings[0])); n++)
+		BENCH_Row("MeasureText", BENCH_Strings[n].text, BENCH_TextWidth, 0, n);
+
+	BENCH_Row("DrawBitmap", "16x16 page aligned", BENCH_BitmapAligned, BENCH_Clear, BITMAP_OPAQUE);
+	BENCH_Row("DrawBitmap", "16x16 opaque", BENCH_Bitmap, BENCH_Clear, BITMAP_OPAQUE);
+	BENCH_Row("DrawBitmap", "16x16 transparent", BENCH_Bitmap, BENCH_Clear, BITMAP_TRANSPARENT);
+
+	// Large clock from the digit sprites, compare with FontPrint "23:59:59"
+	CLOCK_Init();
+	BENCH_Row("CLOCK_Draw", "all cells", BENCH_Time, BENCH_TimeClear, 59);
+	BENCH_Row("CLOCK_Draw", "one digit", BENCH_Time, BENCH_TimeReset, 59);
+	BENCH_Row("CLOCK_Draw", "two digits", BENCH_Time, BENCH_TimeReset, 50);
+	BENCH_Row("CLOCK_Draw", "unchanged", BENCH_Time, 0, 59);
+
+	for (int slope = 0; slope < 5; slope++)
+		BENCH_Row("DrawLine", BENCH_LineName[slope], BENCH_Line, BENCH_Clear, slope);
+
+	for (int r = 0; r < 3; r++)
+	{
+		snprintf(case_, sizeof(case_), "r=%d", radii[r]);
+		BENCH_Row("DrawCircle", case_, BENCH_Circle, BENCH_Clear, radii[r]);
+		BENCH_Row("DrawFilledCircle", case_, BENCH_FilledCircle, BENCH_Clear, radii[r]);
+	}
+
+	BENCH_Row("InvertRegion", "text line", BENCH_Invert, 0, 12);
+	BENCH_Row("InvertRegion", "full screen", BENCH_Invert, 0, SH1106_HEIGHT);
+	BENCH_Row("ClearBuffer", "full screen", BENCH_Clear, BENCH_Fill, 0);
+	BENCH_Row("ClearBuffer", "already clear", BENCH_Clear, 0, 0);
+	BENCH_Row("SendBuffer", "full refresh", BENCH_Send, BENCH_Invalidate, 0);
+	BENCH_Row("SendBuffer", "unchanged", BENCH_Send, 0, 0);
+
+	SH1106_ClearBuffer();
+	SH1106_Invalidate();
+	SH1106_SendBuffer();
+}
+
+#ifndef BENCH_HOST
+const char *const BENCH_Unit = "cycles";
+
+/*******************************************************************
+ * @name       : BENCH_ClockInit
+ * @brief      : Starts the DWT cycle counter
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void BENCH_ClockInit(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // Enable the trace unit
+	DWT->LAR = 0xC5ACCE55;                           // Unlock the DWT registers (Cortex-M7)
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************
+ * @name       : BENCH_Clock
+ * @brief      : Returns the cycle counter
+ * @parameters : None
+ * @return     : Core cycles
+ *******************************************************************/
+uint32_t BENCH_Clock(void)
+{
+	return DWT->CYCCNT;
+}
+
+/*******************************************************************
+ * @name       : BENCH_Print
+ * @brief      : Prints a line of results over USART3
+ * @parameters : format - Format string as in printf
+ * @return     : None
+ *******************************************************************/
+void BENCH_Print(const char *format, ...)
+{
+	char buffer[96];
+	va_list args;
+	va_start(args, format);
+	vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+
+	USART_Serial_Print("%s", buffer);
+}
+#endif
@@ -0,0 +1,85 @@
+#include "../Inc/boot.h"
+#include "../Inc/tim.h"
+
+typedef struct {
+	BOOT_Step step;
+	BOOT_Callback done;
+	TIMER_TypeDef timer;    // Wait before the next step
+} BOOT_SequenceTypeDef;
+
+static BOOT_SequenceTypeDef BOOT_Sequences[BOOT_MAX_SEQUENCES];
+static uint8_t BOOT_SequenceCount = 0;
+static uint8_t BOOT_Running = 0;     // Sequences not over
+
+static BOOT_StatsTypeDef BOOT_Stats;
+
+/*******************************************************************
+ * @name       : BOOT_Next
+ * @brief      : Runs the next step of a sequence
+ * @details    : Timer callback; starts the wait before the following
+ *               step or ends the sequence
+ * @parameters : context - Sequence
+ * @return     : None
+ *******************************************************************/
+static void BOOT_Next(void *context)
+{
+	BOOT_SequenceTypeDef *sequence = (BOOT_SequenceTypeDef *)context;
+	uint32_t delay = sequence->step();
+
+	if (delay)
+	{
+		TIMER_Start(&sequence->timer, delay, 0, BOOT_Next, sequence);
+		return;
+	}
+
+	if (!--BOOT_Running) BOOT_Stats.finished = TIM_GetMilliseconds();
+	if (sequence->done) sequence->done();
+}
+
+/*******************************************************************
+ * @name       : BOOT_Start
+ * @brief      : Starts a start-up sequence
+ * @details    : The first step runs at once, the next ones from the
+ *               timers of the scheduler loop
+ * @parameters : step - Step function of the sequence
+ *               done - Called when the sequence is over, may be 0
+ * @return     : 1 if started, 0 if the table is full
+ *******************************************************************/
+uint8_t BOOT_Start(BOOT_Step step, BOOT_Callback done)
+{
+	if (BOOT_SequenceCount >= BOOT_MAX_SEQUENCES) return 0;
+
+	BOOT_SequenceTypeDef *sequence = &BOOT_Sequences[BOOT_SequenceCount++];
+	sequence->step = step;
+	sequence->done = done;
+
+	if (!BOOT_Running++)
+	{
+		BOOT_Stats.started = TIM_GetMilliseconds();
+		BOOT_Stats.finished = 0;
+	}
+	BOOT_Next(sequence);
+	return 1;
+}
+
+/*******************************************************************
+ * @name       : BOOT_IsDone
+ * @brief      : Returns the state of the start-up
+ * @parameters : None
+ * @return     : 1 once every sequence started is over, 0 otherwise
+ *******************************************************************/
+uint8_t BOOT_IsDone(void)
+{
+	return BOOT_Running ? 0 : 1;
+}
+
+/*******************************************************************
+ * @name       : BOOT_GetStats
+ * @brief      : Returns the boot counters
+ * @parameters : None
+ * @return     : Pointer to the counters
+ *******************************************************************/
+const BOOT_StatsTypeDef *BOOT_GetStats(void)
+{
+	return &BOOT_Stats;
+}
@@ -1,4 +1,5 @@
 #include "../Inc/buttons.h"
+#include "../Inc/tim.h"
 
 // Delay values for button press detection
 #define TIM4_PRESCALER_VALUE 16000
@@ -7,14 +8,47 @@
 
 #define RESET_TIM4_COUNTER TIM4->CNT = 0
 
-// Global variables to store button states
-volatile uint8_t BUTTON_TopState = 0;
-volatile uint8_t BUTTON_BottomState = 0;
-volatile uint8_t BUTTON_RightState = 0;
-volatile uint8_t BUTTON_LeftState = 0;
+// Interrupt sources, one event ring each
+#define BUTTONS_SOURCE_TOP    0 // EXTI15_10
+#define BUTTONS_SOURCE_BOTTOM 1 // EXTI2
+#define BUTTONS_SOURCE_RIGHT  2 // EXTI4
+#define BUTTONS_SOURCE_LEFT   3 // EXTI3
+#define BUTTONS_SOURCE_REPEAT 4 // TIM4
+#define BUTTONS_SOURCES       5
+
+// Single-producer single-consumer ring: only the interrupt of the source
+// writes head, only the application writes tail, so neither side waits
+// or masks interrupts. The indexes run free and wrap at 256.
+typedef struct {
+	BUTTONS_EventTypeDef events[BUTTONS_QUEUE_SIZE];
+	volatile uint8_t head;   // Next event to write
+	volatile uint8_t tail;   // Next event to read
+} BUTTONS_QueueTypeDef;
+
+static BUTTONS_QueueTypeDef BUTTONS_Queues[BUTTONS_SOURCES];
+
+// State of the Switch
 volatile uint8_t BUTTON_Switch = 0;
 
-static uint8_t begin = 0;
+static BUTTONS_Callback BUTTONS_PressCallback = 0;
+
+// Queue an event from the interrupt of its source and notify the application
+static void BUTTONS_Push(uint8_t source, uint8_t button, uint8_t repeat)
+{
+	BUTTONS_QueueTypeDef *queue = &BUTTONS_Queues[source];
+	uint8_t head = queue->head;
+
+	if ((uint8_t)(head - queue->tail) >= BUTTONS_QUEUE_SIZE) return; // Full, the event is dropped
+
+	BUTTONS_EventTypeDef *event = &queue->events[head & (BUTTONS_QUEUE_SIZE - 1)];
+	event->time = TIM_GetMilliseconds();
+	event->button = button;
+	event->repeat = repeat;
+	__DMB(); // The event is written before it is published
+	queue->head = head + 1;
+
+	if (BUTTONS_PressCallback) BUTTONS_PressCallback();
+}
 
 // Initialize GPIO for buttons
 static void BUTTONS_InitGPIO(void)
@@ -90,10 +124,10 @@ void EXTI15_10_IRQHandler(void)
 {
 	if (EXTI->PR & EXTI_PR_PR11)
 	{
-		RESET_TIM4_COUNTER; // Reset TIM3 counter
+		TIM4->ARR = TIM4_PUSH_DELAY_VALUE - 1; // First repeat after the hold delay
+		RESET_TIM4_COUNTER; // Reset TIM4 counter
 		EXTI->PR |= EXTI_PR_PR11; // Clear interrupt flag
-		BUTTON_TopState = 1; // Set Top Button state
-		begin = 1;
+		BUTTONS_Push(BUTTONS_SOURCE_TOP, BUTTON_TOP, 0);
 	}
 }
 
@@ -102,10 +136,10 @@ void EXTI2_IRQHandler(void)
 {
 	if (EXTI->PR & EXTI_PR_PR2)
 	{
-		RESET_TIM4_COUNTER; // Reset TIM3 counter
+		TIM4->ARR = TIM4_PUSH_DELAY_VALUE - 1; // First repeat after the hold delay
+		RESET_TIM4_COUNTER; // Reset TIM4 counter
 		EXTI->PR |= EXTI_PR_PR2; // Clear interrupt flag
-		BUTTON_BottomState = 1; // Set Right Button state
-		begin = 1;
+		BUTTONS_Push(BUTTONS_SOURCE_BOTTOM, BUTTON_BOTTOM, 0);
 	}
 }
 
@@ -115,7 +149,7 @@ void EXTI4_IRQHandler(void)
 	if (EXTI->PR & EXTI_PR_PR4)
 	{
 		EXTI->PR |= EXTI_PR_PR4; // Clear interrupt flag
-		BUTTON_RightState = 1; // Set Bottom Button state
+		BUTTONS_Push(BUTTONS_SOURCE_RIGHT, BUTTON_RIGHT, 0);
 	}
 }
 
@@ -125,7 +159,7 @@ void EXTI3_IRQHandler(void)
 	if (EXTI->PR & EXTI_PR_PR3)
 	{
 		EXTI->PR |= EXTI_PR_PR3; // Clear interrupt flag
-		BUTTON_LeftState = 1; // Set Left Button state
+		BUTTONS_Push(BUTTONS_SOURCE_LEFT, BUTTON_LEFT, 0);
 	}
 }
 
@@ -135,7 +169,8 @@ void BUTTONS_KeyState(void)
 	BUTTON_Switch = (GPIOE->IDR & GPIO_IDR_ID0) ? 1 : 0;
 }
 
-// TIM4 interrupt handler for button repetition and hold detection
+// TIM4 interrupt handler for button repetition: a held Top or Bottom button
+// repeats after the hold delay, then at the repeat rate
 void TIM4_IRQHandler(void)
 {
 	if (TIM4->SR & TIM_SR_UIF) // Check if update interrupt flag is set
@@ -144,33 +179,61 @@ void TIM4_IRQHandler(void)
 
 		if ((GPIOD->IDR & GPIO_IDR_ID11) && !(GPIOE->IDR & GPIO_IDR_ID2))
 		{
-			BUTTON_TopState = 1; // Top button pressed
-			if (begin) // If this is the first time you press and hold the button
-			{
-				TIM4->ARR = TIM4_INCREMENT_DELAY_VALUE - 1; // Set auto-reload value for repetition
-				begin = 0; // We leave the case of the first prolonged press on the button.
-			}
+			BUTTONS_Push(BUTTONS_SOURCE_REPEAT, BUTTON_TOP, 1); // Top button held
+			TIM4->ARR = TIM4_INCREMENT_DELAY_VALUE - 1; // Set auto-reload value for repetition
 		}
 		else if ((GPIOE->IDR & GPIO_IDR_ID2) && !(GPIOD->IDR & GPIO_IDR_ID11))
 		{    
-			BUTTON_BottomState = 1; // Bottom button pressed
-			if (begin) // If this is the first time you press and hold the button
-			{
-				TIM4->ARR = TIM4_INCREMENT_DELAY_VALUE - 1; // Set auto-reload value for repetition
-				begin = 0; // We leave the case of the first prolonged press on the button.
-			}
+			BUTTONS_Push(BUTTONS_SOURCE_REPEAT, BUTTON_BOTTOM, 1); // Bottom button held
+			TIM4->ARR = TIM4_INCREMENT_DELAY_VALUE - 1; // Set auto-reload value for repetition
 		}
 		else
 		{
 			// None or all buttons pressed
-			TIM4->ARR = TIM4_PUSH_DELAY_VALUE - 1; // Set auto-reload value for repetition
-			BUTTON_TopState = 0;
-			BUTTON_BottomState = 0;
+			TIM4->ARR = TIM4_PUSH_DELAY_VALUE - 1; // Set auto-reload value for the next hold
 		}
 		RESET_TIM4_COUNTER; // Reset TIM4 counter
 	}
 }
 
+// Take the oldest input event of all the rings, so presses and repeats come
+// out in the order they happened (application side only); 0 if none
+uint8_t BUTTONS_GetEvent(BUTTONS_EventTypeDef *event)
+{
+	BUTTONS_QueueTypeDef *oldest = 0;
+
+	for (uint8_t source = 0; source < BUTTONS_SOURCES; source++)
+	{
+		BUTTONS_QueueTypeDef *queue = &BUTTONS_Queues[source];
+		uint8_t tail = queue->tail;
+
+		if (queue->head == tail) continue;
+		__DMB(); // The event is read after its publication
+		if (!oldest || (int32_t)(queue->events[tail & (BUTTONS_QUEUE_SIZE - 1)].time - oldest->events[oldest->tail & (BUTTONS_QUEUE_SIZE - 1)].time) < 0)
+			oldest = queue;
+	}
+
+	if (!oldest) return 0;
+
+	*event = oldest->events[oldest->tail & (BUTTONS_QUEUE_SIZE - 1)];
+	__DMB(); // The event is copied before its slot is given back
+	oldest->tail++;
+	return 1;
+}
+
+// Discard the pending input events (application side only)
+void BUTTONS_Flush(void)
+{
+	for (uint8_t source = 0; source < BUTTONS_SOURCES; source++)
+		BUTTONS_Queues[source].tail = BUTTONS_Queues[source].head;
+}
+
+// Set the function called when a button is pressed or repeats (0 to disable)
+void BUTTONS_SetCallback(BUTTONS_Callback callback)
+{
+	BUTTONS_PressCallback = callback;
+}
+
 // Initialize buttons and related peripherals
 void BUTTONS_Init(void)
 {
@@ -0,0 +1,147 @@
+#include "../Inc/clock.h"
+#include "../Fonts/fonts.h"
+
+#include <string.h>
+
+#define CLOCK_COLON   10 // Sprite of the colon, after the ten digits
+#define CLOCK_SPRITES 11
+#define CLOCK_NONE    0xFF
+
+// Digits and colon pre-rendered at the row alignment of the clock,
+// in the page-major layout of the SH1106 buffer
+static uint8_t CLOCK_Sprites[CLOCK_SPRITES][CLOCK_PAGES][CLOCK_CELL_WIDTH];
+static uint8_t CLOCK_Width[CLOCK_SPRITES];
+
+// Rows of the clock inside each page
+static uint8_t CLOCK_Masks[CLOCK_PAGES];
+
+// Left column of each cell and sprite shown in it
+static int16_t CLOCK_CellX[CLOCK_CELLS];
+static uint8_t CLOCK_Shown[CLOCK_CELLS];
+
+/*******************************************************************
+ * @name       : CLOCK_Render
+ * @brief      : Pre-renders a character into a sprite
+ * @details    : Draws the glyph pixel by pixel, shifted by the row
+ *               offset of the clock inside its first page and cut
+ *               at the clock height, the rest of the cell stays off
+ * @parameters : sprite - Sprite number
+ *               letterNumberAscii - ASCII value of the character
+ * @return     : None
+ *******************************************************************/
+static void CLOCK_Render(uint8_t sprite, uint8_t letterNumberAscii)
+{
+	const Font *font = &CLOCK_FONT;
+	const FontGlyph *glyph = FONT_GetGlyph(font, letterNumberAscii);
+	uint8_t shift = CLOCK_Y % SH1106_DATA_SIZE;
+
+	memset(CLOCK_Sprites[sprite], 0, sizeof(CLOCK_Sprites[sprite]));
+	CLOCK_Width[sprite] = 0;
+	if (!glyph) return;
+
+	CLOCK_Width[sprite] = glyph->advance + (font->length / 10);
+	if (CLOCK_Width[sprite] > CLOCK_CELL_WIDTH) CLOCK_Width[sprite] = CLOCK_CELL_WIDTH;
+
+	const uint8_t *data = &font->data[glyph->offset];
+	for (int column = 0; column < glyph->columns; column++)
+	{
+		int x = glyph->xOffset + column;
+		if (x >= CLOCK_Width[sprite]) break;
+
+		for (int row = 0; row < 8 * glyph->byteCount; row++)
+		{
+			int y = 8 * glyph->firstByte + row;
+			if (y >= font->height || y >= CLOCK_HEIGHT) break;
+
+			if ((data[glyph->byteCount * column + row / 8] >> (row % 8)) & 1)
+				CLOCK_Sprites[sprite][(shift + y) / SH1106_DATA_SIZE][x] |= 1 << ((shift + y) % SH1106_DATA_SIZE);
+		}
+	}
+}
+
+/*******************************************************************
+ * @name       : CLOCK_Init
+ * @brief      : Prepares the large clock of the main screen
+ * @details    : Pre-renders the ten digits and the colon, computes
+ *               the page masks of the clock rows and the cell
+ *               positions of HH:MM:SS. To be called once at startup
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void CLOCK_Init(void)
+{
+	for (uint8_t digit = 0; digit < 10; digit++)
+		CLOCK_Render(digit, '0' + digit);
+	CLOCK_Render(CLOCK_COLON, ':');
+
+	for (uint8_t page = 0; page < CLOCK_PAGES; page++)
+	{
+		int top = CLOCK_Y - (CLOCK_FIRST_PAGE + page) * SH1106_DATA_SIZE;
+		int bottom = top + CLOCK_HEIGHT - 1;
+		uint8_t mask = 0;
+
+		for (int bit = 0; bit < SH1106_DATA_SIZE; bit++)
+			if (bit >= top && bit <= bottom) mask |= 1 << bit;
+		CLOCK_Masks[page] = mask;
+	}
+
+	// Digits share one width (tabular figures), the widest is used for every digit cell
+	uint8_t digitWidth = 0;
+	for (uint8_t digit = 0; digit < 10; digit++)
+		if (CLOCK_Width[digit] > digitWidth) digitWidth = CLOCK_Width[digit];
+	for (uint8_t digit = 0; digit < 10; digit++)
+		CLOCK_Width[digit] = digitWidth;
+
+	int16_t x = CLOCK_X;
+	for (uint8_t cell = 0; cell < CLOCK_CELLS; cell++)
+	{
+		CLOCK_CellX[cell] = x;
+		x += (cell % 3 == 2) ? CLOCK_Width[CLOCK_COLON] : digitWidth;
+	}
+
+	CLOCK_Invalidate();
+}
+
+/*******************************************************************
+ * @name       : CLOCK_Draw
+ * @brief      : Draws the time as HH:MM:SS
+ * @details    : Copies the sprite of each cell whose character
+ *               changed since the previous call, usually one or two
+ *               digits per second; the buffer only records the
+ *               columns that really changed as dirty
+ * @parameters : hour - Hour (0 to 23)
+ *               minute - Minute (0 to 59)
+ *               second - Second (0 to 59)
+ * @return     : None
+ *******************************************************************/
+void CLOCK_Draw(int8_t hour, int8_t minute, int8_t second)
+{
+	const uint8_t sprites[CLOCK_CELLS] = {
+		(hour / 10) % 10, hour % 10, CLOCK_COLON,
+		(minute / 10) % 10, minute % 10, CLOCK_COLON,
+		(second / 10) % 10, second % 10
+	};
+
+	for (uint8_t cell = 0; cell < CLOCK_CELLS; cell++)
+	{
+		uint8_t sprite = sprites[cell];
+		if (sprite == CLOCK_Shown[cell]) continue;
+
+		SH1106_CopyPages(CLOCK_CellX[cell], CLOCK_FIRST_PAGE, CLOCK_Width[sprite], CLOCK_PAGES,
+		                 &CLOCK_Sprites[sprite][0][0], CLOCK_CELL_WIDTH, CLOCK_Masks);
+		CLOCK_Shown[cell] = sprite;
+	}
+}
+
+/*******************************************************************
+ * @name       : CLOCK_Invalidate
+ * @brief      : Forgets the cells drawn in the buffer
+ * @details    : To be called when the buffer was cleared or drawn
+ *               over under the clock, the next draw copies every cell
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void CLOCK_Invalidate(void)
+{
+	memset(CLOCK_Shown, CLOCK_NONE, sizeof(CLOCK_Shown));
+}
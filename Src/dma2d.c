@@ -0,0 +1,172 @@
+#include "../Inc/dma2d.h"
+
+// DMA2D transfer modes (CR.MODE)
+#define DMA2D_MODE_M2M (0U)
+#define DMA2D_MODE_R2M (DMA2D_CR_MODE_0 | DMA2D_CR_MODE_1)
+
+/*******************************************************************
+ * @name       : DMA2D_Init
+ * @brief      : Initializes the memory fill and copy
+ * @details    : Enables the clock of the Chrom-ART accelerator.
+ *               Without DMA2D every transfer is done by the CPU.
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void DMA2D_Init(void)
+{
+#ifdef DMA2D
+	RCC->AHB1ENR |= RCC_AHB1ENR_DMA2DEN;
+#endif
+}
+
+/*******************************************************************
+ * @name       : DMA2D_Busy
+ * @brief      : Returns the state of the last transfer
+ * @parameters : None
+ * @return     : 1 if the accelerator is still writing, 0 otherwise
+ *******************************************************************/
+uint8_t DMA2D_Busy(void)
+{
+#ifdef DMA2D
+	// START is cleared by the hardware at the end of the transfer or on error
+	return (DMA2D->CR & DMA2D_CR_START) ? 1 : 0;
+#else
+	return 0;
+#endif
+}
+
+/*******************************************************************
+ * @name       : DMA2D_Wait
+ * @brief      : Waits for the end of the last transfer
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void DMA2D_Wait(void)
+{
+	while (DMA2D_Busy());
+}
+
+#ifdef DMA2D
+/*******************************************************************
+ * @name       : DMA2D_Start
+ * @brief      : Starts a one line transfer of 32-bit pixels
+ * @parameters : mode - DMA2D_MODE_R2M or DMA2D_MODE_M2M
+ *               destination - Word-aligned output address
+ *               source - Word-aligned input address (M2M only)
+ *               color - Output pixel (R2M only)
+ *               words - Number of words (up to DMA2D_MAX_WORDS)
+ * @return     : None
+ *******************************************************************/
+static void DMA2D_Start(uint32_t mode, uint32_t *destination, const uint32_t *source, uint32_t color, uint32_t words)
+{
+	DMA2D->CR = mode;
+	DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
+
+	// ARGB8888 in and out: bytes are moved four at a time, unchanged
+	DMA2D->FGPFCCR = 0;
+	DMA2D->OPFCCR = 0;
+	DMA2D->FGMAR = (uint32_t)source;
+	DMA2D->FGOR = 0;
+	DMA2D->OCOLR = color;
+	DMA2D->OMAR = (uint32_t)destination;
+	DMA2D->OOR = 0;
+	DMA2D->NLR = (words << DMA2D_NLR_PL_Pos) | 1;
+
+	DMA2D->CR |= DMA2D_CR_START;
+}
+#endif
+
+/*******************************************************************
+ * @name       : DMA2D_Fill
+ * @brief      : Sets a block of memory to a value
+ * @details    : Waits for the previous transfer, writes the bytes
+ *               outside the aligned words, then starts the fill of
+ *               the words and returns; call DMA2D_Wait before
+ *               reading or writing the block
+ * @parameters : destination - Block to fill
+ *               value - Byte written
+ *               size - Size of the block (in bytes)
+ * @return     : None
+ *******************************************************************/
+void DMA2D_Fill(void *destination, uint8_t value, uint32_t size)
+{
+	uint8_t *bytes = destination;
+	uint32_t pattern = value * 0x01010101U;
+
+	DMA2D_Wait();
+
+	// Head up to a word boundary, then the tail
+	while (size && ((uintptr_t)bytes & 3))
+	{
+		*bytes++ = value;
+		size--;
+	}
+	uint32_t *words = (uint32_t *)bytes;
+	uint32_t count = size / 4;
+	for (bytes += count * 4, size -= count * 4; size; size--) *bytes++ = value;
+
+#ifdef DMA2D
+	if (count * 4 >= DMA2D_MIN_SIZE)
+	{
+		// A longer block does not fit in one line, the CPU writes the end
+		for (uint32_t n = DMA2D_MAX_WORDS; n < count; n++) words[n] = pattern;
+		if (count > DMA2D_MAX_WORDS) count = DMA2D_MAX_WORDS;
+
+		DMA2D_Start(DMA2D_MODE_R2M, words, 0, pattern, count);
+		return;
+	}
+#endif
+
+	while (count--) *words++ = pattern;
+}
+
+/*******************************************************************
+ * @name       : DMA2D_Copy
+ * @brief      : Copies a block of memory
+ * @details    : Same as DMA2D_Fill: the copy of the aligned words
+ *               may still run when the function returns. The blocks
+ *               must not overlap. Blocks of different alignments
+ *               are copied by the CPU byte by byte.
+ * @parameters : destination - Block to write
+ *               source - Block to read
+ *               size - Size of the blocks (in bytes)
+ * @return     : None
+ *******************************************************************/
+void DMA2D_Copy(void *destination, const void *source, uint32_t size)
+{
+	uint8_t *bytes = destination;
+	const uint8_t *from = source;
+
+	DMA2D_Wait();
+
+	if (((uintptr_t)bytes ^ (uintptr_t)from) & 3)
+	{
+		while (size--) *bytes++ = *from++;
+		return;
+	}
+
+	// Head up to a word boundary, then the tail
+	while (size && ((uintptr_t)bytes & 3))
+	{
+		*bytes++ = *from++;
+		size--;
+	}
+	uint32_t *words = (uint32_t *)bytes;
+	const uint32_t *fromWords = (const uint32_t *)from;
+	uint32_t count = size / 4;
+	for (bytes += count * 4, from += count * 4, size -= count * 4; size; size--) *bytes++ = *from++;
+
+#ifdef DMA2D
+	if (count * 4 >= DMA2D_MIN_SIZE)
+	{
+		// A longer block does not fit in one line, the CPU copies the end
+		for (uint32_t n = DMA2D_MAX_WORDS; n < count; n++) words[n] = fromWords[n];
+		if (count > DMA2D_MAX_WORDS) count = DMA2D_MAX_WORDS;
+
+		DMA2D_Start(DMA2D_MODE_M2M, words, fromWords, 0, count);
+		return;
+	}
+#endif
+
+	while (count--) *words++ = *fromWords++;
+}
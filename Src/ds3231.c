@@ -2,6 +2,8 @@
 #include "../Inc/tim.h"
 #include "../Inc/usart.h"
 
+static DS3231_Callback DS3231_TickCallback = 0;
+
 /*******************************************************************
  * @name       :DS3231_GPIO_Config
  * @function   :Configure GPIO
@@ -50,7 +52,6 @@ void DS3231_Init(void)
 {
     DS3231_GPIO_Config();
     DS3231_I2C_Config();
-    //TIM2_InitForGeneralPurpose(); // Uncomment if necessary
 }
 
 /*******************************************************************
@@ -77,7 +78,7 @@ int DS3231_DecToBcd(unsigned char x)
 
 /*******************************************************************
  * @name       :DS3231_Read
- * @function   :Read data from DS3231 memory with timeout using TIM2
+ * @function   :Read data from DS3231 memory with timeout in microseconds
  * @parameters :memadd, data, length, timeout
  * @retvalue   :Status of the operation
  *******************************************************************/
@@ -94,17 +95,12 @@ int DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint32_t timeout)
     I2C1->CR2 &= ~I2C_CR2_AUTOEND;
     I2C1->CR2 |= I2C_CR2_START;             // Generate start condition
 
-    TIM2_StopTimer();
-    TIM2_ResetCounter();
-    TIM2_SetTimer(timeout);
-    TIM2_StartTimer();
+    uint32_t start = TIM_GetMicroseconds(); // Deadline on the free-running counter
 
     while (!(I2C1->ISR & I2C_ISR_TC)) // Wait for transfer completion
     {
-        if (TIM2_TimeoutFlag()) // Timeout check
+        if ((uint32_t)(TIM_GetMicroseconds() - start) >= timeout) // Timeout check
         {
-            TIM2_ResetTimeoutFlag();
-            TIM2_StopTimer();
             return DS3231_TIMEOUT_ERROR;
         }
 
@@ -125,10 +121,8 @@ int DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint32_t timeout)
 
     while (!(I2C1->ISR & I2C_ISR_STOPF)) // Wait for stop condition
     {
-        if (TIM2_TimeoutFlag()) // Timeout check
+        if ((uint32_t)(TIM_GetMicroseconds() - start) >= timeout) // Timeout check
         {
-            TIM2_ResetTimeoutFlag();
-            TIM2_StopTimer();
             return DS3231_TIMEOUT_ERROR;
         }
 
@@ -138,14 +132,13 @@ int DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint32_t timeout)
         }
     }
 
-    TIM2_StopTimer();
     I2C1->CR1 &= ~I2C_CR1_PE;
     return DS3231_SUCCESS;
 }
 
 /*******************************************************************
  * @name       :DS3231_Write
- * @function   :Write data to DS3231 memory with timeout using TIM2
+ * @function   :Write data to DS3231 memory with timeout in microseconds
  * @parameters :memadd, data, length, timeout
  * @retvalue   :Status of the operation
  *******************************************************************/
@@ -166,16 +159,12 @@ int DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint32_t timeout
     // Send memory address and data
     int i = 0;  // Initialize index for data
 
-    TIM2_StopTimer();
-    TIM2_ResetCounter();
-    TIM2_SetTimer(timeout);
-    TIM2_StartTimer();
+    uint32_t start = TIM_GetMicroseconds(); // Deadline on the free-running counter
 
     while (!(I2C1->ISR & I2C_ISR_STOPF)) // Wait for stop condition
     {
-        if (TIM2_TimeoutFlag()) // Timeout check
+        if ((uint32_t)(TIM_GetMicroseconds() - start) >= timeout) // Timeout check
         {
-            TIM2_ResetTimeoutFlag();
             return DS3231_TIMEOUT_ERROR;
         }
 
@@ -187,7 +176,80 @@ int DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint32_t timeout
     }
 
     // Disable I2C1 after transmission
-    TIM2_StopTimer();
     I2C1->CR1 &= ~I2C_CR1_PE;
     return DS3231_SUCCESS;
 }
+
+/*******************************************************************
+ * @name       :DS3231_SQW_Config
+ * @function   :Configure PC6 as input with pull-up and EXTI line 6 on
+ *              the falling edge of INT/SQW
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void DS3231_SQW_Config(void)
+{
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN;    // Enable GPIOC clock
+    RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;   // Enable clock for EXTI unit
+
+    GPIOC->MODER &= ~GPIO_MODER_MODER6;     // Input
+    GPIOC->PUPDR &= ~GPIO_PUPDR_PUPDR6;
+    GPIOC->PUPDR |= GPIO_PUPDR_PUPDR6_0;    // Pull-up, the pin is open drain
+
+    SYSCFG->EXTICR[1] &= ~SYSCFG_EXTICR2_EXTI6;
+    SYSCFG->EXTICR[1] |= SYSCFG_EXTICR2_EXTI6_PC;
+    EXTI->FTSR |= EXTI_FTSR_TR6;             // Falling edge: start of a second
+    EXTI->PR = EXTI_PR_PR6;                  // Clear a pending edge
+    EXTI->IMR |= EXTI_IMR_MR6;
+
+    NVIC_SetPriority(EXTI9_5_IRQn, 5);
+    NVIC_EnableIRQ(EXTI9_5_IRQn);
+}
+
+/*******************************************************************
+ * @name       :DS3231_EnableSquareWave
+ * @function   :Program INT/SQW as a 1 Hz square wave and enable its
+ *              interrupt. The registers are updated on the falling
+ *              edge, so the time can be counted from the edges and
+ *              read only to resynchronize.
+ * @parameters :timeout (microseconds, per I2C transfer)
+ * @retvalue   :Status of the operation
+ *******************************************************************/
+int DS3231_EnableSquareWave(uint32_t timeout)
+{
+    uint8_t control;
+
+    if (DS3231_Read(DS3231_REG_CONTROL, &control, 1, timeout)) return DS3231_TIMEOUT_ERROR;
+
+    control &= ~(DS3231_CONTROL_INTCN | DS3231_CONTROL_RS1 | DS3231_CONTROL_RS2);
+    if (DS3231_Write(DS3231_REG_CONTROL, &control, 1, timeout)) return DS3231_TIMEOUT_ERROR;
+
+    DS3231_SQW_Config();
+    return DS3231_SUCCESS;
+}
+
+/*******************************************************************
+ * @name       :DS3231_SetTickCallback
+ * @function   :Set the function called at each second (0 to disable)
+ * @parameters :callback
+ * @retvalue   :None
+ *******************************************************************/
+void DS3231_SetTickCallback(DS3231_Callback callback)
+{
+    DS3231_TickCallback = callback;
+}
+
+/*******************************************************************
+ * @name       :EXTI9_5_IRQHandler
+ * @function   :INT/SQW falling edge, one per second
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void EXTI9_5_IRQHandler(void)
+{
+    if (EXTI->PR & EXTI_PR_PR6)
+    {
+        EXTI->PR = EXTI_PR_PR6; // Clear interrupt flag (write 1)
+        if (DS3231_TickCallback) DS3231_TickCallback();
+    }
+}
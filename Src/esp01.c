@@ -7,6 +7,7 @@
 uint8_t ESP01_TXBuffer[ESP_BUF_SIZE] = {0};
 uint8_t ESP01_RXBuffer[ESP_BUF_SIZE] = {0};
 volatile uint8_t DataReady = 0; // Flag pour signaler que les donnes sont prtes
+static ESP01_Callback ESP01_ReceiveCallback = 0;
 
 /*******************************************************************
  * @name       :ESP01_GPIO_Config
@@ -116,6 +117,7 @@ void DMA1_Stream3_IRQHandler(void)
     {
         DMA1->HIFCR |= DMA_LIFCR_CTCIF3; // Effacer le flag d'interruption
         DataReady = 1; // Indiquer que des donnes sont prtes
+        if (ESP01_ReceiveCallback) ESP01_ReceiveCallback();
     }
 }
 
@@ -153,6 +155,15 @@ uint8_t ESP01_GetReceivedData(uint8_t *buffer, uint16_t maxSize)
     return length; // Retourner la taille des donnes copies
 }
 
+/*******************************************************************
+ * @name       :ESP01_SetReceiveCallback
+ * @function   :Set the function called when data is received (0 to disable)
+ *******************************************************************/
+void ESP01_SetReceiveCallback(ESP01_Callback callback)
+{
+    ESP01_ReceiveCallback = callback;
+}
+
 /*******************************************************************
  * @name       :ESP01_Init
  * @function   :Initialize ESP01 module
@@ -163,3 +174,31 @@ void ESP01_Init(void)
     ESP01_USART_Config();
     ESP01_DMA_Config();
 }
+
+/*******************************************************************
+ * @name       :ESP01_StartStep
+ * @function   :Run one step of the module configuration: mode query,
+ *              station mode 2s later, then 1s for the module to apply
+ *              it; the caller waits between the steps (Inc/boot.h)
+ * @retvalue   :Milliseconds to wait before the next step, 0 when the
+ *              module is configured
+ *******************************************************************/
+uint32_t ESP01_StartStep(void)
+{
+    static uint8_t step = 0;
+
+    switch (step++)
+    {
+        case 0:
+            ESP01_Transmit_DMA("AT+CWMODE?\r\n");
+            return 2000;
+
+        case 1:
+            ESP01_Transmit_DMA("AT+CWMODE=1\r\n");     // Station mode
+            return 1000;
+
+        default:
+            step = 0;
+            return 0;
+    }
+}
@@ -6,9 +6,12 @@
 #include "../Inc/urm37.h"
 #include "../Inc/usart.h"
 #include "../Inc/esp01.h"
-
-const char *days[] = {"NA", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"}; 
-const char *months[] = {"NA", "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
+#include "../Inc/screen.h"
+#include "../Inc/clock.h"
+#include "../Inc/bench.h"
+#include "../Inc/scheduler.h"
+#include "../Inc/timer.h"
+#include "../Inc/boot.h"
 
 static int8_t DS3231_Second = 0;
 static int8_t DS3231_Minute = 0;
@@ -25,25 +28,68 @@ static uint8_t UpdateToSetting = 0;
 int move = 0;
 static uint8_t state = 0;
 
+// Date of the DS3231, read then counted from its 1 Hz square wave
+static SCREEN_DateTypeDef MAIN_Date;
+static uint8_t MAIN_DateError = 0;
+
+// DS3231 seconds: the interrupt counts the edges, the RTC task the ones seen
+static volatile uint32_t MAIN_RtcTicks = 0;
+static uint32_t MAIN_RtcSeen = 0;
+static uint8_t MAIN_RtcCounted = 0;     // Seconds counted since the last read
+static uint8_t MAIN_RtcResync = 1;      // Read the DS3231 at the next run
+static TIMER_TypeDef MAIN_RtcWatchdog;  // Reads when the square wave stops
+
+// Milliseconds from TIM_Init to the start of the first frame transfer
+static uint32_t MAIN_FirstFrame = 0;
+
+// Task periods (in milliseconds)
+#define MAIN_INPUT_PERIOD 50   // Switch polling, settings screen refresh
+#define MAIN_LED_PERIOD   50   // Heartbeat LEDs
+#define MAIN_RTC_TIMEOUT  1200 // No square wave edge for this long: read the DS3231
+#define MAIN_RTC_RESYNC   60   // Seconds counted between two DS3231 reads (temperature every 64 s)
+#define MAIN_URM37_PERIOD 1000 // One URM37 measure, temperature and distance in turn
+
+static uint8_t MAIN_InputTaskId;
+static uint8_t MAIN_RtcTaskId;
+static uint8_t MAIN_RenderTaskId;
+static uint8_t MAIN_Esp01TaskId;
+
+static void MAIN_ReadDate(void);
+static uint8_t MAIN_AdvanceDate(void);
 static void MAIN_DisplayDate(void);
 static void MAIN_Settings(void);
+static void MAIN_InputTask(void);
+static void MAIN_RtcTask(void);
+static void MAIN_LedTask(void);
+static void MAIN_RenderTask(void);
+static void MAIN_Esp01Task(void);
+static void MAIN_Urm37Task(void);
+static void MAIN_ButtonPressed(void);
+static void MAIN_Esp01Received(void);
+static void MAIN_DisplayReady(void);
+static void MAIN_RtcTick(void);
+static void MAIN_RtcTimeout(void *context);
 
 int main(void) 
 {
-	TIM1_InitForDelay();
-	TIM2_Init();
-	SH1106_Init();
+	TIM_Init();
+	// Drivers with power-up waits come up side by side from the timers
+	// of the scheduler loop, drawing goes on in the buffer meanwhile
+	BOOT_Start(SH1106_InitStep, MAIN_DisplayReady);
+	SH1106_SetDoubleBuffer(1);
 	SH1106_ClearBuffer();
+	CLOCK_Init();
 	USART_Serial_Begin(9600); 
+#ifdef BENCH
+	// Rendering benchmarks over USART3, build with BENCH defined
+	while (!SH1106_IsReady()) TIMER_Process(TIM_GetMilliseconds());
+	BENCH_Run();
+#endif
 	BUTTONS_Init();
 	DS3231_Init();
 	URM37_Init();
 	ESP01_Init();	
-	
-	ESP01_Transmit_DMA("AT+CWMODE?\r\n");
-	TIM1_WaitMilliseconds(2000);
-	ESP01_Transmit_DMA("AT+CWMODE=1\r\n");
-	TIM1_WaitMilliseconds(1000);
+	BOOT_Start(ESP01_StartStep, 0);
 	
 	GPIO_PinMode(GPIOB, 7, OUTPUT);
 	GPIO_PinMode(GPIOB, 14, OUTPUT);
@@ -61,31 +107,156 @@ int main(void)
 	{
 		while(1);
 	}
+	// Without the square wave the RTC task falls back on MAIN_RTC_TIMEOUT
+	DS3231_EnableSquareWave(40000);
+
+	// Tasks in priority order: input first, rendering after the data it shows
+	MAIN_InputTaskId = SCHEDULER_Add(MAIN_InputTask, MAIN_INPUT_PERIOD);
+	MAIN_RtcTaskId = SCHEDULER_Add(MAIN_RtcTask, 0);
+	MAIN_RenderTaskId = SCHEDULER_Add(MAIN_RenderTask, 0);
+	MAIN_Esp01TaskId = SCHEDULER_Add(MAIN_Esp01Task, 0);
+	SCHEDULER_Add(MAIN_Urm37Task, MAIN_URM37_PERIOD);
+	SCHEDULER_Add(MAIN_LedTask, MAIN_LED_PERIOD);
+
+	BUTTONS_KeyState();
+	BUTTONS_SetCallback(MAIN_ButtonPressed);
+	ESP01_SetReceiveCallback(MAIN_Esp01Received);
+	DS3231_SetTickCallback(MAIN_RtcTick);
+	SCHEDULER_Post(MAIN_RtcTaskId);
+
+	SCHEDULER_Run();
+}
+
+// Button interrupts: handle the new state at once
+static void MAIN_ButtonPressed(void)
+{
+	SCHEDULER_Post(MAIN_InputTaskId);
+}
+
+// End of the display start-up: show the first frame without waiting for a task period
+static void MAIN_DisplayReady(void)
+{
+	SCHEDULER_Post(MAIN_RenderTaskId);
+}
+
+// DS3231 square wave interrupt: a new second
+static void MAIN_RtcTick(void)
+{
+	MAIN_RtcTicks++;
+	SCHEDULER_Post(MAIN_RtcTaskId);
+}
 
-	while (1) 
+// No square wave edge since the last RTC task run
+static void MAIN_RtcTimeout(void *context)
+{
+	(void)context;
+	MAIN_RtcResync = 1;
+	SCHEDULER_Post(MAIN_RtcTaskId);
+}
+
+// ESP01 reception interrupt
+static void MAIN_Esp01Received(void)
+{
+	SCHEDULER_Post(MAIN_Esp01TaskId);
+}
+
+// Reads the switch; the settings screen is redrawn on every input, the 
+// date screen after a DS3231 reading
+static void MAIN_InputTask(void)
+{
+	uint8_t mode = BUTTON_Switch;
+
+	BUTTONS_KeyState();
+	if (BUTTON_Switch == 1) SCHEDULER_Post(MAIN_RenderTaskId);
+	else if (mode != BUTTON_Switch)
 	{
-		SH1106_ClearBuffer();
-		BUTTONS_KeyState();
-		GPIO_DigitalWrite(GPIOB, 7, state);	
-		GPIO_DigitalWrite(GPIOB, 14, !state);	
-		TIM1_WaitMilliseconds(50);
-		
-		switch (BUTTON_Switch)
-		{
-			case 0:
-				MAIN_DisplayDate();
-				break;
-			case 1:
-				MAIN_Settings();
-				break;
-		}
-		state ^= 1;
+		MAIN_RtcResync = 1;
+		SCHEDULER_Post(MAIN_RtcTaskId);
+	}
+}
 
-		SH1106_SendBuffer();
+// Toggles the heartbeat LEDs
+static void MAIN_LedTask(void)
+{
+	GPIO_DigitalWrite(GPIOB, 7, state);
+	GPIO_DigitalWrite(GPIOB, 14, !state);
+	state ^= 1;
+}
+
+// Runs at each DS3231 second and on a resync. On the date screen the 
+// seconds are counted locally; the DS3231 is read on a resync, every 
+// MAIN_RTC_RESYNC seconds, at midnight and after an error.
+static void MAIN_RtcTask(void)
+{
+	uint32_t ticks = MAIN_RtcTicks;
+	uint32_t elapsed = ticks - MAIN_RtcSeen;
+
+	MAIN_RtcSeen = ticks;
+	TIMER_Start(&MAIN_RtcWatchdog, MAIN_RTC_TIMEOUT, 0, MAIN_RtcTimeout, 0);
+
+	if (BUTTON_Switch != 0) return;
+
+	MAIN_RtcCounted += elapsed;
+	if (MAIN_RtcCounted >= MAIN_RTC_RESYNC || MAIN_DateError) MAIN_RtcResync = 1;
+	while (elapsed-- && !MAIN_RtcResync) MAIN_RtcResync = MAIN_AdvanceDate();
+
+	if (MAIN_RtcResync)
+	{
+		MAIN_ReadDate();
+		MAIN_RtcResync = 0;
+		MAIN_RtcCounted = 0;
+	}
+	SCHEDULER_Post(MAIN_RenderTaskId);
+}
+
+// Draws the current screen and starts its transfer
+static void MAIN_RenderTask(void)
+{
+	switch (BUTTON_Switch)
+	{
+		case 0:
+			MAIN_DisplayDate();
+			break;
+		case 1:
+			MAIN_Settings();
+			break;
+	}
+
+	SH1106_SendBuffer();
+
+	// Time to first frame, reported once
+	if (!MAIN_FirstFrame && SH1106_IsReady())
+	{
+		MAIN_FirstFrame = TIM_GetMilliseconds();
+		USART_Serial_Print("First frame after %lu ms\r\n", (unsigned long)MAIN_FirstFrame);
 	}
 }
 
+// Forwards what the ESP01 sent to the serial port
+static void MAIN_Esp01Task(void)
+{
+	uint8_t data[ESP_BUF_SIZE];
+	uint8_t length = ESP01_GetReceivedData(data, sizeof(data));
+
+	if (length) USART_Serial_Print("%.*s", length, (const char *)data);
+}
+
+// Starts a URM37 measure, the result arrives by interrupt
+static void MAIN_Urm37Task(void)
+{
+	static uint8_t distance = 0;
+
+	URM37_Measure(distance ? URM37_Distance : URM37_Temperature);
+	distance ^= 1;
+}
+
 static void MAIN_DisplayDate(void)
+{
+	if (MAIN_DateError) SCREEN_Error("E:DS3231");
+	else SCREEN_Date(&MAIN_Date);
+}
+
+static void MAIN_ReadDate(void)
 {
 	UpdateToSetting = 1;
 	
@@ -98,10 +269,7 @@ static void MAIN_DisplayDate(void)
 			while(1);
 		}
 		
-		BUTTON_TopState = 0;
-		BUTTON_BottomState = 0;
-		BUTTON_RightState = 0;
-		BUTTON_LeftState = 0;
+		BUTTONS_Flush();
 		
 		move = 0;
 		UpdateToDisplay = 0;
@@ -109,12 +277,9 @@ static void MAIN_DisplayDate(void)
 	
 	uint8_t data[7] = {0};
 	uint8_t data_temp[2] = {0};
-	if (DS3231_Read(0x0,data,7, 3000)
-	 || DS3231_Read(0x11, data_temp, 2, 1500))
-	{
-		SH1106_FontPrint(1, 7, 13, &Arial12x12, "E:DS3231");
-	}
-	else 
+	MAIN_DateError = DS3231_Read(0x0,data,7, 3000)
+	              || DS3231_Read(0x11, data_temp, 2, 1500);
+	if (!MAIN_DateError)
 	{
 		DS3231_Second = DS3231_BcdToDec(data[0] & 0x7F);
 		DS3231_Minute = DS3231_BcdToDec(data[1]);
@@ -134,49 +299,46 @@ static void MAIN_DisplayDate(void)
 
 		float temperature = value / 4.0f;
 		
-		SH1106_FontPrint(1, 0, 0, &Arial12x12, "Temp: %.2f", temperature);
-		SH1106_FontPrint(1, 7, 13, &Arial28x28, "%02d:%02d:%02d", DS3231_Hour, DS3231_Minute, DS3231_Second);
+		MAIN_Date = (SCREEN_DateTypeDef){temperature, DS3231_Second, DS3231_Minute, DS3231_Hour, DS3231_DayWeek, DS3231_DayMonth, DS3231_Month, DS3231_Year, DS3231_Century};
 		//USART_Serial_Print("%02d:%02d:%02d\r\n", DS3231_Hour, DS3231_Minute, DS3231_Second);
-		SH1106_FontPrint(1, 0, 39, &Arial12x12, "%s,", days[DS3231_DayWeek]);
-		SH1106_FontPrint(1, 0, 52, &Arial12x12, "%s %d, 2%d%02d", months[DS3231_Month], DS3231_DayMonth, DS3231_Century, DS3231_Year);
-		SH1106_DrawLine(1, 0, 37, 131, 37);
-		SH1106_DrawLine(1, 0, 12, 131, 12);
 	}
 }
 
-static void handling(int8_t* data, const char* title, int max, int min)
+// Counts one second on the date; returns 1 at midnight, the calendar is 
+// then read from the DS3231
+static uint8_t MAIN_AdvanceDate(void)
 {
-	if (BUTTON_TopState) 
-	{
-		(*data)++;
-		BUTTON_TopState = 0;
-	}
-	if (BUTTON_BottomState) 
+	if (DS3231_Second == 59 && DS3231_Minute == 59 && DS3231_Hour == 23) return 1;
+
+	if (++DS3231_Second > 59)
 	{
-		(*data)--;
-		BUTTON_BottomState = 0;
+		DS3231_Second = 0;
+		if (++DS3231_Minute > 59)
+		{
+			DS3231_Minute = 0;
+			DS3231_Hour++;
+		}
 	}
 
+	MAIN_Date.second = DS3231_Second;
+	MAIN_Date.minute = DS3231_Minute;
+	MAIN_Date.hour = DS3231_Hour;
+	return 0;
+}
+
+static void handling(int8_t* data, int8_t delta, int max, int min)
+{
+	*data += delta;
+
 	if (*data > max) *data = min;
 	if (*data < min) *data = max;
-
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting %s : %d", title, *data);
 }
 
-static void handlingDay()
+static void handlingDay(int8_t delta)
 {
 	uint8_t isLeapYear = (DS3231_Year %4 == 0 && DS3231_Year %100 != 0) || (DS3231_Year %400 == 0);
 
-	if (BUTTON_TopState) 
-	{
-		DS3231_DayMonth++;
-		BUTTON_TopState = 0;
-	}
-	if (BUTTON_BottomState) 
-	{
-		DS3231_DayMonth--;
-		BUTTON_BottomState = 0;
-	}
+	DS3231_DayMonth += delta;
 
 	if ((DS3231_Month == 4 || DS3231_Month == 6 || DS3231_Month == 9 || DS3231_Month == 11) && (DS3231_DayMonth > 30)) DS3231_DayMonth=0;
 	if ((DS3231_Month == 4 || DS3231_Month == 6 || DS3231_Month == 9 || DS3231_Month == 11) && (DS3231_DayMonth < 0)) DS3231_DayMonth=30;
@@ -188,24 +350,13 @@ static void handlingDay()
 	if (DS3231_Month == 2 && !isLeapYear && DS3231_DayMonth > 28) DS3231_DayMonth = 0;
 	if (DS3231_Month == 2 && isLeapYear && DS3231_DayMonth < 0) DS3231_DayMonth = 29;
 	if (DS3231_Month == 2 && !isLeapYear && DS3231_DayMonth < 0) DS3231_DayMonth = 28;
-
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting day : %d", DS3231_DayMonth);
 }
 
-static void handlingMonth()
+static void handlingMonth(int8_t delta)
 {
 	uint8_t isLeapYear = (DS3231_Year %4 == 0 && DS3231_Year %100 != 0) || (DS3231_Year %400 == 0);
 
-	if (BUTTON_TopState) 
-	{
-		DS3231_Month++;
-		BUTTON_TopState = 0;
-	}
-	if (BUTTON_BottomState) 
-	{
-		DS3231_Month--;
-		BUTTON_BottomState = 0;
-	}
+	DS3231_Month += delta;
 
 	if (DS3231_Month>12) DS3231_Month=1;
 	if (DS3231_Month<1) DS3231_Month=12;
@@ -214,85 +365,84 @@ static void handlingMonth()
 
 	if (DS3231_Month == 2 && isLeapYear && DS3231_DayMonth > 29) DS3231_DayMonth = 29;                                 //Cas de Fevrier dans les annees bissextiles (29 jours)
 	if (DS3231_Month == 2 && !isLeapYear && DS3231_DayMonth > 28) DS3231_DayMonth = 28;                                //Cas de Fevrier hors annees bissextiles (28 jours)
-
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting month : %d", DS3231_Month);
 }
 
-static void handlingYear()
+static void handlingYear(int8_t delta)
 {
 	uint8_t isLeapYear = (DS3231_Year %4 == 0 && DS3231_Year %100 != 0) || (DS3231_Year %400 == 0);
 
-	if (BUTTON_TopState) 
-	{
-		DS3231_Year++;
-		BUTTON_TopState = 0;
-	}
-	if (BUTTON_BottomState) 
-	{
-		DS3231_Year--;
-		BUTTON_BottomState = 0;
-	}
+	DS3231_Year += delta;
 
 	if (DS3231_Year>99) DS3231_Year=0;
 	if (DS3231_Year<0) DS3231_Year=99;
 
 	if (DS3231_Month == 2 && isLeapYear && DS3231_DayMonth > 29) DS3231_DayMonth = 29;           // Cas de Fevrier dans les annees bissextiles (29 jours)
 	if (DS3231_Month == 2 && !isLeapYear && DS3231_DayMonth > 28) DS3231_DayMonth = 28;          // Cas de Fevrier hors annees bissextiles (28 jours)
-
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting year : %d", DS3231_Year);
 }
 
-static void MAIN_Settings(void)
+// Applies a Top or Bottom step to the field selected by move
+static void MAIN_SettingsStep(int8_t delta)
 {
-	//keyboard();
-	UpdateToDisplay = 1;
-	
-	if (UpdateToSetting)
-	{
-		BUTTON_TopState = 0;
-		BUTTON_BottomState = 0;
-		BUTTON_RightState = 0;
-		BUTTON_LeftState = 0;
-		
-		UpdateToSetting = 0;
-	}
-
-	if (BUTTON_RightState) 
-	{
-		move++;
-		BUTTON_RightState = 0;
-	}
-	if (BUTTON_LeftState) 
-	{
-		move--;
-		BUTTON_LeftState = 0;
-	}
-  
-	if (move > 6) move = 0;
-	if (move < 0) move = 6;
-  
 	switch (move)
 	{
 		case 0:
-			handling(&DS3231_Second, "sec", 59, 0);
+			handling(&DS3231_Second, delta, 59, 0);
 			break;
 		case 1:
-			handling(&DS3231_Minute, "min", 59, 0);
+			handling(&DS3231_Minute, delta, 59, 0);
 			break;
 		case 2:
-			handling(&DS3231_Hour, "hour", 23, 0);
+			handling(&DS3231_Hour, delta, 23, 0);
 			break;
 		case 3:
-			handling(&DS3231_DayWeek, "dayW", 7, 1);
+			handling(&DS3231_DayWeek, delta, 7, 1);
 			break;
 		case 4:
-			handlingDay();
+			handlingDay(delta);
 			break;
 		case 5:
-			handlingMonth();
+			handlingMonth(delta);
 			break;
 		case 6:
-			handlingYear();
+			handlingYear(delta);
 			break;
 	}
 }
+
+// Applies the input events in the order they came, then draws the field
+static void MAIN_Settings(void)
+{
+	static const char *const titles[7] = {"sec", "min", "hour", "dayW", "day", "month", "year"};
+	int8_t *const values[7] = {&DS3231_Second, &DS3231_Minute, &DS3231_Hour, &DS3231_DayWeek, &DS3231_DayMonth, &DS3231_Month, &DS3231_Year};
+	BUTTONS_EventTypeDef event;
+
+	UpdateToDisplay = 1;
+	
+	if (UpdateToSetting)
+	{
+		BUTTONS_Flush();
+		UpdateToSetting = 0;
+	}
+
+	while (BUTTONS_GetEvent(&event))
+	{
+		switch (event.button)
+		{
+			case BUTTON_RIGHT:
+				if (++move > 6) move = 0;
+				break;
+			case BUTTON_LEFT:
+				if (--move < 0) move = 6;
+				break;
+			case BUTTON_TOP:
+				MAIN_SettingsStep(1);
+				break;
+			case BUTTON_BOTTOM:
+				MAIN_SettingsStep(-1);
+				break;
+		}
+	}
+	MAIN_SettingsStep(0);
+
+	SCREEN_Setting("Setting %s : %d", titles[move], *values[move]);
+}
@@ -0,0 +1,111 @@
+#include "../Inc/scheduler.h"
+#include "../Inc/tim.h"
+
+typedef struct {
+	SCHEDULER_Task run;
+	TIMER_TypeDef timer;     // Posts a periodic task
+	volatile uint8_t ready;  // Posted, runs at the next pass
+} SCHEDULER_TaskTypeDef;
+
+static SCHEDULER_TaskTypeDef SCHEDULER_Tasks[SCHEDULER_MAX_TASKS];
+static uint8_t SCHEDULER_TaskCount = 0;
+
+static SCHEDULER_StatsTypeDef SCHEDULER_Stats;
+
+// Timer callback of the periodic tasks
+static void SCHEDULER_Expired(void *context)
+{
+	((SCHEDULER_TaskTypeDef *)context)->ready = 1;
+}
+
+/*******************************************************************
+ * @name       : SCHEDULER_Add
+ * @brief      : Adds a task
+ * @details    : A periodic task first runs one period after it is
+ *               added; any task can also be posted
+ * @parameters : task - Function to run
+ *               period - Milliseconds between two runs, 0 to run
+ *                        only when posted
+ * @return     : Task identifier for SCHEDULER_Post, 0xFF if the
+ *               table is full
+ *******************************************************************/
+uint8_t SCHEDULER_Add(SCHEDULER_Task task, uint32_t period)
+{
+	if (SCHEDULER_TaskCount >= SCHEDULER_MAX_TASKS) return 0xFF;
+
+	SCHEDULER_TaskTypeDef *entry = &SCHEDULER_Tasks[SCHEDULER_TaskCount];
+	entry->run = task;
+	entry->ready = 0;
+	if (period) TIMER_Start(&entry->timer, period, period, SCHEDULER_Expired, entry);
+
+	return SCHEDULER_TaskCount++;
+}
+
+/*******************************************************************
+ * @name       : SCHEDULER_Post
+ * @brief      : Makes a task ready
+ * @details    : Safe from interrupts; posting a task already ready
+ *               runs it once
+ * @parameters : id - Task identifier returned by SCHEDULER_Add
+ * @return     : None
+ *******************************************************************/
+void SCHEDULER_Post(uint8_t id)
+{
+	if (id < SCHEDULER_TaskCount) SCHEDULER_Tasks[id].ready = 1;
+}
+
+/*******************************************************************
+ * @name       : SCHEDULER_Run
+ * @brief      : Runs the tasks, never returns
+ * @details    : Each pass runs the software timers due, then the
+ *               first ready task, and starts again, so a task posted
+ *               by an interrupt waits at most for the end of the
+ *               running task. With nothing ready the core sleeps;
+ *               interrupts are masked between the last check and WFI
+ *               so a post cannot be missed (a pending interrupt
+ *               still ends WFI).
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void SCHEDULER_Run(void)
+{
+	while (1)
+	{
+		uint32_t now = TIM_GetMilliseconds();
+		TIMER_Process(now);
+
+		uint8_t id;
+		for (id = 0; id < SCHEDULER_TaskCount; id++)
+			if (SCHEDULER_Tasks[id].ready) break;
+
+		if (id < SCHEDULER_TaskCount)
+		{
+			SCHEDULER_Tasks[id].ready = 0;
+			SCHEDULER_Tasks[id].run();
+			SCHEDULER_Stats.runs++;
+			continue;
+		}
+
+		__disable_irq();
+		uint8_t ready = (now != TIM_GetMilliseconds());
+		for (id = 0; id < SCHEDULER_TaskCount && !ready; id++)
+			ready = SCHEDULER_Tasks[id].ready;
+		if (!ready)
+		{
+			SCHEDULER_Stats.sleeps++;
+			__WFI();
+		}
+		__enable_irq();
+	}
+}
+
+/*******************************************************************
+ * @name       : SCHEDULER_GetStats
+ * @brief      : Returns the scheduler counters
+ * @parameters : None
+ * @return     : Pointer to the counters
+ *******************************************************************/
+const SCHEDULER_StatsTypeDef *SCHEDULER_GetStats(void)
+{
+	return &SCHEDULER_Stats;
+}
@@ -0,0 +1,117 @@
+#include "../Inc/screen.h"
+#include "../Inc/clock.h"
+#include "../Inc/sh1106.h"
+#include "../Inc/widget.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+// Screens, the buffer is cleared only when the screen changes
+#define SCREEN_NONE     0
+#define SCREEN_DATE     1
+#define SCREEN_ERROR    2
+#define SCREEN_SETTINGS 3
+
+static const char *days[] = {"NA", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"}; 
+static const char *months[] = {"NA", "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
+
+static uint8_t SCREEN_Current = SCREEN_NONE;
+
+// Display offsets cycled every minute on the clock (pixel shifting against burn-in).
+// The offset wraps around: the date layout keeps rows 0 and 63 blank so 
+// nothing moves from one edge of the glass to the other.
+static const uint8_t SCREEN_Shift[] = {0, 1, 0, SH1106_HEIGHT - 1};
+
+static WIDGET_TextTypeDef SCREEN_TempWidget = WIDGET_TEXT(0, 1, SH1106_WIDTH, 11, &Arial12x12);
+static WIDGET_TextTypeDef SCREEN_DayWidget = WIDGET_TEXT(0, 39, SH1106_WIDTH, 12, &Arial12x12);
+static WIDGET_TextTypeDef SCREEN_DateWidget = WIDGET_TEXT(0, 51, SH1106_WIDTH, 12, &Arial12x12);
+static WIDGET_TextTypeDef SCREEN_ErrorWidget = WIDGET_TEXT(7, 13, SH1106_WIDTH - 7, 12, &Arial12x12);
+static WIDGET_TextTypeDef SCREEN_SettingWidget = WIDGET_TEXT(0, 13, SH1106_WIDTH, 12, &Arial12x12);
+
+static WIDGET_TextTypeDef *const SCREEN_Widgets[] = {
+	&SCREEN_TempWidget, &SCREEN_DayWidget, &SCREEN_DateWidget, &SCREEN_ErrorWidget, &SCREEN_SettingWidget};
+
+/*******************************************************************
+ * @name       : SCREEN_Set
+ * @brief      : Switches to another screen
+ * @details    : Clears the buffer, invalidates the widgets and the 
+ *               clock and puts the display offset back to 0 when the 
+ *               screen changes (only the date screen shifts)
+ * @parameters : screen - Screen to show
+ * @return     : 1 if the screen changed, 0 otherwise
+ *******************************************************************/
+static uint8_t SCREEN_Set(uint8_t screen)
+{
+	if (screen == SCREEN_Current) return 0;
+
+	SH1106_ClearBuffer();
+	for (uint8_t i = 0; i < sizeof(SCREEN_Widgets) / sizeof(SCREEN_Widgets[0]); i++)
+		WIDGET_Invalidate(SCREEN_Widgets[i]);
+	CLOCK_Invalidate();
+	SH1106_SetOffset(0);
+
+	SCREEN_Current = screen;
+	return 1;
+}
+
+/*******************************************************************
+ * @name       : SCREEN_Date
+ * @brief      : Draws the main screen
+ * @details    : Temperature, time, weekday and date, separated by 
+ *               two lines drawn once when the screen is entered. 
+ *               The whole image moves by one row each minute through 
+ *               the display offset, without redrawing anything.
+ * @parameters : date - Date and time to show
+ * @return     : None
+ *******************************************************************/
+void SCREEN_Date(const SCREEN_DateTypeDef *date)
+{
+	if (SCREEN_Set(SCREEN_DATE))
+	{
+		SH1106_DrawHLine(1, 0, 37, SH1106_WIDTH);
+		SH1106_DrawHLine(1, 0, 12, SH1106_WIDTH);
+	}
+
+	WIDGET_Print(&SCREEN_TempWidget, "Temp: %.2f", date->temperature);
+	CLOCK_Draw(date->hour, date->minute, date->second);
+	WIDGET_Print(&SCREEN_DayWidget, "%s,", days[date->dayWeek]);
+	WIDGET_Print(&SCREEN_DateWidget, "%s %d, 2%d%02d", months[date->month], date->dayMonth, date->century, date->year);
+
+	SH1106_SetOffset(SCREEN_Shift[date->minute % sizeof(SCREEN_Shift)]);
+}
+
+/*******************************************************************
+ * @name       : SCREEN_Error
+ * @brief      : Draws the error screen
+ * @parameters : message - Error message
+ * @return     : None
+ *******************************************************************/
+void SCREEN_Error(const char *message)
+{
+	SCREEN_Set(SCREEN_ERROR);
+	WIDGET_Print(&SCREEN_ErrorWidget, "%s", message);
+}
+
+/*******************************************************************
+ * @name       : SCREEN_Setting
+ * @brief      : Draws the settings screen
+ * @details    : The setting line is drawn in inverse video
+ * @parameters : format - Formatted setting line
+ * @return     : None
+ *******************************************************************/
+void SCREEN_Setting(const char *format, ...)
+{
+	char text[WIDGET_TEXT_SIZE];
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(text, sizeof(text), format, args);
+	va_end(args);
+
+	SCREEN_Set(SCREEN_SETTINGS);
+
+	// The edited setting is highlighted, inverted in place after each redraw
+	WIDGET_TextTypeDef *widget = &SCREEN_SettingWidget;
+	if (WIDGET_Print(widget, "%s", text))
+		SH1106_InvertRegion(widget->x, widget->y, widget->width, widget->height);
+}
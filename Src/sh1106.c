@@ -1,88 +1,74 @@
 #include "../Inc/sh1106.h"
+#include "../Inc/sh1106_port.h"
+#include "../Inc/dma2d.h"
 #include "../Inc/tim.h"
 
-#include <stdarg.h>
-#include <stdio.h>
+// Back buffer: every drawing function writes here
+static uint8_t SH1106_Buffer[(SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE] __ALIGNED(4);
+
+// Set while a DMA2D fill or copy of the back buffer may still be running
+static uint8_t SH1106_BufferPending = 0;
+
+// Front buffer: copy of the display RAM, used to send only the columns 
+// that really changed, and streamed by DMA in double buffer mode
+static uint8_t SH1106_Front[(SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE] __ALIGNED(4);
+static uint8_t SH1106_DoubleBuffer = 0;
+
+// Column range written in each page since the last frame (empty when min > max)
+static uint8_t SH1106_DirtyMin[SH1106_PAGES];
+static uint8_t SH1106_DirtyMax[SH1106_PAGES];
+static uint8_t SH1106_FullRefresh = 1;
+
+// Column windows of the current frame
+static uint8_t SH1106_WindowPage[SH1106_PAGES];
+static uint8_t SH1106_WindowStart[SH1106_PAGES];
+static uint8_t SH1106_WindowEnd[SH1106_PAGES];
+static const uint8_t *SH1106_WindowData[SH1106_PAGES];
+static uint8_t SH1106_WindowCount = 0;
+
+static SH1106_StatsTypeDef SH1106_Stats;
+
+// Display start line and COM offset (hardware scrolling)
+static uint8_t SH1106_StartLine = 0;
+static uint8_t SH1106_Offset = 0;
+
+// Start-up state (SH1106_InitStep), frames wait for the screen configuration
+static uint8_t SH1106_InitState = 0;
+static uint8_t SH1106_Ready = 0;
+
+// Page masks: rows from n to the bottom of the page, rows from the top of the page to n
+static const uint8_t SH1106_MaskFrom[SH1106_DATA_SIZE] = {0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80};
+static const uint8_t SH1106_MaskTo[SH1106_DATA_SIZE] = {0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+
+// Buffer write counter, enabled by the host benchmarks (Host/Makefile)
+#ifdef SH1106_PROFILE
+uint32_t SH1106_PixelOps = 0;
+#define SH1106_COUNT_OPS(n) (SH1106_PixelOps += (n))
+#else
+#define SH1106_COUNT_OPS(n)
+#endif
+
+// DMA page transfer state
+static uint8_t SH1106_PageCmd[3];
+static volatile uint8_t SH1106_TransferBusy = 0;
+static volatile uint8_t SH1106_TransferWindow = 0;
+static volatile uint8_t SH1106_TransferPhase = 0;
+static SH1106_Callback SH1106_TransferCallback = 0;
 
-static uint8_t SH1106_Buffer[(SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE];
-
-static void SH1106_GPIO_Init(void);
-static void SH1106_SPI1_Init(void);
 static void SH1106_Screen_Init(void);
-static void SH1106_SpiTransmit(uint8_t msg);
-static void SH1106_SendCmd(uint8_t cmd);
 static void SH1106_SendDoubleCmd(uint8_t cmd1, uint8_t cmd2);
-static void SH1106_SendData(uint8_t data);
-static void SH1106_Reset(void);
+static void SH1106_StartWindow(uint8_t window);
+static void SH1106_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1);
+static void SH1106_FillArea(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
 
-/*******************************************************************
- * @name       : SH1106_GPIO_Init
- * @brief      : Initializes GPIO for SH1106 display
- * @details    : Configures GPIO pins for DC, CS, RST, SCK, and MOSI
- * @parameters : None
- * @return     : None
- *******************************************************************/
-static void SH1106_GPIO_Init(void)
+// Waits for the fill or copy of the back buffer before touching it, and 
+// for the transfer streaming it when double buffering is off
+static inline void SH1106_SyncBuffer(void)
 {
-	// Enable clock for GPIOA and GPIOC
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN;  // Enable clock for GPIOA
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN;  // Enable clock for GPIOC
-
-	// PA0-DC (GPIOA pin 0)
-	GPIOA->MODER |= GPIO_MODER_MODER0_0;  // Configure as output mode
-	GPIOA->MODER &= ~GPIO_MODER_MODER0_1; // Reset bits to configure as output
-
-	// PC0-CS (GPIOC pin 0)
-	GPIOC->MODER |= GPIO_MODER_MODER0_0;  // Configure as output mode
-	GPIOC->MODER &= ~GPIO_MODER_MODER0_1; // Reset bits to configure as output
-
-	// PC1-RST (GPIOC pin 1)
-	GPIOC->MODER |= GPIO_MODER_MODER1_0;  // Configure as output mode
-	GPIOC->MODER &= ~GPIO_MODER_MODER1_1; // Reset bits to configure as output
-
-	// PA5-SCK (GPIOA pin 5)
-	GPIOA->MODER |= GPIO_MODER_MODER5_1;  // Configure as alternate function (SCK)
-	GPIOA->MODER &= ~GPIO_MODER_MODER5_0; // Reset bits to configure as alternate function
-	GPIOA->AFR[0] |= SH1106_SPI1_AF << GPIO_AFRL_AFRL5_Pos; // Configure PA5 for SPI1
-
-	// PA7-MOSI (GPIOA pin 7)
-	GPIOA->MODER |= GPIO_MODER_MODER7_1;  // Configure as alternate function (MOSI)
-	GPIOA->MODER &= ~GPIO_MODER_MODER7_0; // Reset bits to configure as alternate function
-	GPIOA->AFR[0] |= SH1106_SPI1_AF << GPIO_AFRL_AFRL7_Pos; // Configure PA7 for SPI1
-}
-
-/*******************************************************************
- * @name       : SH1106_SPI1_Init
- * @brief      : Initializes SPI1 for SH1106 display
- * @details    : Configures SPI1 in master mode with specific settings
- * @parameters : None
- * @return     : None
- *******************************************************************/
-static void SH1106_SPI1_Init(void)
-{
-	// Enable clock for the SPI1 module
-	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
-
-	// SPI1 configuration
-	// Set MSB first
-	SPI1->CR1 &= ~SPI_CR1_LSBFIRST;
-
-	// Configure SPI as MASTER
-	SPI1->CR1 |= SPI_CR1_MSTR;
-
-	// Select software slave management (SSM=1, SSI=1)
-	SPI1->CR1 |= SPI_CR1_SSM;
-	SPI1->CR1 |= SPI_CR1_SSI;
-
-	// Configure SPI mode (MODE1: CPHA=0, CPOL=0)
-	SPI1->CR1 &= ~SPI_CR1_CPHA;
-	SPI1->CR1 &= ~SPI_CR1_CPOL;
-
-	// Set SPI frequency to 500 kHz
-	SPI1->CR1 |= SPI_CR1_BR_2;
-
-	// Enable the SPI module
-	SPI1->CR1 |= SPI_CR1_SPE;
+	if (!SH1106_DoubleBuffer) while (SH1106_TransferBusy);
+	if (!SH1106_BufferPending) return;
+	DMA2D_Wait();
+	SH1106_BufferPending = 0;
 }
 
 /*******************************************************************
@@ -94,81 +80,101 @@ static void SH1106_SPI1_Init(void)
  *******************************************************************/
 static void SH1106_Screen_Init(void)
 {
-	// Reset
-	SH1106_Reset();
 	// Display OFF
-	SH1106_SendCmd(SH1106_CMD_DISP_OFF);
+	SH1106_PORT_SendCmd(SH1106_CMD_DISP_OFF);
 	// Set multiplex ratio (visible lines)
 	SH1106_SendDoubleCmd(SH1106_CMD_SETMUX, 0x3F);
-	// Set display offset (offset of first line from the top of display)
-	SH1106_SendDoubleCmd(SH1106_CMD_SETOFFS, 0x00);
-	// Set display start line (first line displayed)
-	SH1106_SendCmd(SH1106_CMD_STARTLINE);
+	// Set display offset (offset of first line from the top of display), as recorded during the start-up
+	SH1106_SendDoubleCmd(SH1106_CMD_SETOFFS, SH1106_Offset);
+	// Set display start line (first line displayed), as recorded during the start-up
+	SH1106_PORT_SendCmd(SH1106_CMD_STARTLINE | SH1106_StartLine);
 	// Set segment re-map (X coordinate)
-	SH1106_SendCmd(SH1106_CMD_SEG_INV);
+	SH1106_PORT_SendCmd(SH1106_CMD_SEG_INV);
 	// Set COM output scan direction (Y coordinate)
-	SH1106_SendCmd(SH1106_CMD_COM_INV);
+	SH1106_PORT_SendCmd(SH1106_CMD_COM_INV);
 	// Set COM pins hardware configuration
 	SH1106_SendDoubleCmd(SH1106_CMD_COM_HW, 0x12);
 	// Set contrast control
 	SH1106_SendDoubleCmd(SH1106_CMD_CONTRAST, 0xFF); // Contrast: middle level
 	// Disable entire display ON
-	SH1106_SendCmd(SH1106_CMD_EDOFF);
+	SH1106_PORT_SendCmd(SH1106_CMD_EDOFF);
 	// Disable display inversion
-	SH1106_SendCmd(SH1106_CMD_INV_OFF);
+	SH1106_PORT_SendCmd(SH1106_CMD_INV_OFF);
 	// Set clock divide ratio and oscillator frequency
 	SH1106_SendDoubleCmd(SH1106_CMD_CLOCKDIV, 0x80);
 	// Display ON
-	SH1106_SendCmd(SH1106_CMD_DISP_ON);
+	SH1106_PORT_SendCmd(SH1106_CMD_DISP_ON);
 }
 
 /*******************************************************************
- * @name       : SH1106_Init
- * @brief      : Initializes the SH1106 display
- * @details    : Calls GPIO, SPI, and screen initialization functions
+ * @name       : SH1106_InitStep
+ * @brief      : Runs one step of the SH1106 start-up
+ * @details    : Configures the transport and the buffers, then resets
+ *               the controller once it has powered up and sends the
+ *               screen configuration; frames are held back until then
  * @parameters : None
- * @return     : None
+ * @return     : Milliseconds to wait before the next step, 0 when the
+ *               display is ready
  *******************************************************************/
-void SH1106_Init(void)
+uint32_t SH1106_InitStep(void)
 {
-	SH1106_GPIO_Init();
-	SH1106_SPI1_Init();
-	TIM1_WaitMilliseconds(200);
-	SH1106_Screen_Init();
+	uint32_t delay;
+
+	switch (SH1106_InitState++)
+	{
+		case 0:
+			SH1106_Ready = 0;
+			SH1106_PORT_Init();
+			DMA2D_Init();
+			for (uint8_t page = 0; page < SH1106_PAGES; page++)
+			{
+				SH1106_DirtyMin[page] = 0xFF;
+				SH1106_DirtyMax[page] = 0;
+			}
+			SH1106_FullRefresh = 1;
+			SH1106_StartLine = 0;
+			SH1106_Offset = 0;
+			return SH1106_POWER_UP_DELAY;
+
+		default:
+			// Hardware reset, then the screen configuration
+			delay = SH1106_PORT_ResetStep();
+			if (delay)
+			{
+				SH1106_InitState = 1;
+				return delay;
+			}
+			SH1106_Screen_Init();
+			SH1106_InitState = 0;
+			SH1106_Ready = 1;
+			return 0;
+	}
 }
 
 /*******************************************************************
- * @name       : SH1106_SpiTransmit
- * @brief      : Transmits data via SPI
- * @details    : Sends a byte of data through the SPI interface
- * @parameters : msg - Data byte to transmit
+ * @name       : SH1106_Init
+ * @brief      : Initializes the SH1106 display
+ * @details    : Runs the start-up steps with busy waits, for programs 
+ *               without the scheduler
+ * @parameters : None
  * @return     : None
  *******************************************************************/
-static void SH1106_SpiTransmit(uint8_t msg)
+void SH1106_Init(void)
 {
-	while (!(SPI1->SR & SPI_SR_TXE));    // Wait until TXE is set or timeout occurs
-	*(volatile uint8_t*) & SPI1->DR = msg; // Write the data to the data register
-	while (!(SPI1->SR & SPI_SR_TXE));    // Wait until TXE is set or timeout occurs
-	while ((SPI1->SR & SPI_SR_BSY));     // Wait for BUSY flag to reset or timeout occurs
-
-	// Clear OVR flag (Overrun flag) by reading DR and SR registers
-	(void)SPI1->DR;
-	(void)SPI1->SR;
+	uint32_t delay;
+
+	while ((delay = SH1106_InitStep())) TIM_WaitMilliseconds(delay);
 }
 
 /*******************************************************************
- * @name       : SH1106_SendCmd
- * @brief      : Sends a command to the SH1106 display
- * @details    : Transmits a command byte to the display
- * @parameters : cmd - Command byte to send
- * @return     : None
+ * @name       : SH1106_IsReady
+ * @brief      : Returns the state of the display
+ * @parameters : None
+ * @return     : 1 once the start-up is over, 0 otherwise
  *******************************************************************/
-static void SH1106_SendCmd(uint8_t cmd)
+uint8_t SH1106_IsReady(void)
 {
-	SH1106_DC_LOW; // Command mode
-	SH1106_CS_LOW;
-	SH1106_SpiTransmit(cmd);
-	SH1106_CS_HIGH;
+	return SH1106_Ready;
 }
 
 /*******************************************************************
@@ -181,363 +187,643 @@ static void SH1106_SendCmd(uint8_t cmd)
  *******************************************************************/
 static void SH1106_SendDoubleCmd(uint8_t cmd1, uint8_t cmd2)
 {
-	SH1106_SendCmd(cmd1);
-	SH1106_SendCmd(cmd2);
+	SH1106_PORT_SendCmd(cmd1);
+	SH1106_PORT_SendCmd(cmd2);
 }
 
 /*******************************************************************
- * @name       : SH1106_SendData
- * @brief      : Sends data to the SH1106 display
- * @details    : Transmits a data byte to the display
- * @parameters : data - Data byte to send
+ * @name       : SH1106_StartWindow
+ * @brief      : Starts the transfer of one column window
+ * @details    : Pulls CS low and sends the page and column address 
+ *               commands by DMA, the window data follows from the 
+ *               DMA interrupt
+ * @parameters : window - Index of the window in the current frame
  * @return     : None
  *******************************************************************/
-static void SH1106_SendData(uint8_t data)
+static void SH1106_StartWindow(uint8_t window)
 {
-	SH1106_DC_HIGH; // Data mode
-	SH1106_CS_LOW;
-	SH1106_SpiTransmit(data);
-	SH1106_CS_HIGH;
+	uint8_t column = SH1106_WindowStart[window] + XLevelL;
+
+	SH1106_PageCmd[0] = YLevel + SH1106_WindowPage[window];
+	SH1106_PageCmd[1] = SH1106_CMD_COL_LOW | (column & 0x0F);
+	SH1106_PageCmd[2] = SH1106_CMD_COL_HIGH | (column >> 4);
+
+	SH1106_TransferWindow = window;
+	SH1106_TransferPhase = SH1106_PHASE_CMD;
+
+	SH1106_PORT_Begin(SH1106_PORT_CMD);
+	SH1106_PORT_Stream(SH1106_PageCmd, sizeof(SH1106_PageCmd));
 }
 
 /*******************************************************************
  * @name       : SH1106_SendBuffer
  * @brief      : Sends the display buffer to the SH1106 display
- * @details    : Transmits the entire buffer to the display
+ * @details    : Compares the dirty column range of each page with 
+ *               the display RAM copy, then starts a DMA transfer of 
+ *               the changed column windows only and returns 
+ *               immediately. Each window is sent as one CS-low 
+ *               burst preceded by its address commands. 
+ *               Waits first if a previous transfer is still running. 
+ *               The changed windows are copied to the front buffer. 
+ *               In double buffer mode the front buffer is streamed 
+ *               while drawing goes on in the back buffer; otherwise 
+ *               the back buffer is streamed and drawing waits for 
+ *               the end of the transfer.
+ *               Sends nothing before the end of the start-up.
  * @parameters : None
  * @return     : None
  *******************************************************************/
 void SH1106_SendBuffer(void)
 {
-	for(int i=0; i<SH1106_DATA_SIZE; i++)
+	if (!SH1106_Ready) return;            // Dirty ranges kept for the first frame
+
+	SH1106_WaitTransfer();
+	SH1106_SyncBuffer();
+
+	SH1106_WindowCount = 0;
+	SH1106_Stats.bytesSent = 0;
+
+	for (uint8_t page = 0; page < SH1106_PAGES; page++)
 	{
-		SH1106_SendCmd(YLevel+i);
-		SH1106_SendCmd(XLevelL);
-		SH1106_SendCmd(XLevelH);
-		for(int n=0; n<SH1106_WIDTH; n++)
+		int16_t start = SH1106_DirtyMin[page];
+		int16_t end = SH1106_DirtyMax[page];
+		uint8_t *buffer = &SH1106_Buffer[page*SH1106_WIDTH];
+		uint8_t *front = &SH1106_Front[page*SH1106_WIDTH];
+
+		if (SH1106_FullRefresh)
 		{
-			SH1106_SendData(SH1106_Buffer[i*SH1106_WIDTH+n]);
+			start = 0;
+			end = SH1106_WIDTH - 1;
 		}
+		else
+		{
+			// Trim the window to the columns that differ from the display RAM
+			while (start <= end && buffer[start] == front[start]) start++;
+			while (end >= start && buffer[end] == front[end]) end--;
+		}
+
+		SH1106_DirtyMin[page] = 0xFF;
+		SH1106_DirtyMax[page] = 0;
+
+		if (start > end) continue;
+
+		// Present the window: the front buffer now holds the new frame
+		DMA2D_Copy(&front[start], &buffer[start], end - start + 1);
+
+		SH1106_WindowPage[SH1106_WindowCount] = page;
+		SH1106_WindowStart[SH1106_WindowCount] = start;
+		SH1106_WindowEnd[SH1106_WindowCount] = end;
+		SH1106_WindowCount++;
+		SH1106_Stats.bytesSent += end - start + 1;
 	}
+
+	DMA2D_Wait();
+	SH1106_FullRefresh = 0;
+	SH1106_Stats.windowsSent = SH1106_WindowCount;
+	SH1106_Stats.commandsSent = SH1106_WindowCount * sizeof(SH1106_PageCmd);
+	SH1106_Stats.totalBytes += SH1106_Stats.bytesSent + SH1106_Stats.commandsSent;
+	SH1106_Stats.frames++;
+
+	if (SH1106_WindowCount == 0) return;  // Nothing changed, no transfer and no callback
+
+	const uint8_t *source = SH1106_DoubleBuffer ? SH1106_Front : SH1106_Buffer;
+	for (uint8_t window = 0; window < SH1106_WindowCount; window++)
+		SH1106_WindowData[window] = &source[SH1106_WindowPage[window]*SH1106_WIDTH + SH1106_WindowStart[window]];
+
+	SH1106_TransferBusy = 1;
+	SH1106_StartWindow(0);
 }
 
 /*******************************************************************
- * @name       : SH1106_Reset
- * @brief      : Resets the SH1106 display
- * @details    : Performs a hardware reset of the display
- * @parameters : None
+ * @name       : SH1106_SendPage
+ * @brief      : Sends one page rendered outside the display buffer
+ * @details    : Starts the DMA transfer of a whole page (SH1106_WIDTH 
+ *               bytes) and returns immediately; the data must stay 
+ *               unchanged until the transfer ends. Waits first if a 
+ *               previous transfer is still running. The display RAM 
+ *               no longer matches the front buffer, so the next 
+ *               SH1106_SendBuffer sends the whole buffer. Sends 
+ *               nothing before the end of the start-up.
+ * @parameters : page - Page number (0 to 7)
+ *               data - Page bytes
  * @return     : None
  *******************************************************************/
-static void SH1106_Reset(void)
+void SH1106_SendPage(uint8_t page, const uint8_t *data)
 {
-	SH1106_RST_HIGH;
-	TIM1_WaitMilliseconds(100);
-	SH1106_RST_LOW;
-	TIM1_WaitMilliseconds(100);
-	SH1106_RST_HIGH;
+	if (!SH1106_Ready) return;            // Controller not reset yet
+
+	SH1106_WaitTransfer();
+
+	SH1106_WindowCount = 1;
+	SH1106_WindowPage[0] = page;
+	SH1106_WindowStart[0] = 0;
+	SH1106_WindowEnd[0] = SH1106_WIDTH - 1;
+	SH1106_WindowData[0] = data;
+
+	SH1106_FullRefresh = 1;
+	SH1106_Stats.totalBytes += SH1106_WIDTH + sizeof(SH1106_PageCmd);
+
+	SH1106_TransferBusy = 1;
+	SH1106_StartWindow(0);
 }
 
 /*******************************************************************
- * @name       : SH1106_SetPixel
- * @brief      : Sets a pixel in the display buffer
- * @details    : Sets or clears a pixel at the specified coordinates
- * @parameters : color - Pixel color (1 = on, 0 = off)
- *               x - Horizontal position (in pixels)
- *               y - Vertical position (in pixels)
+ * @name       : SH1106_SetDoubleBuffer
+ * @brief      : Enables or disables the double buffer mode
+ * @details    : In double buffer mode the DMA streams the front 
+ *               buffer, so drawing in the back buffer does not wait 
+ *               for the end of the transfer. Frame time becomes 
+ *               max(render, transfer) instead of their sum. 
+ *               Otherwise every drawing call waits for the transfer 
+ *               streaming the back buffer.
+ * @parameters : enable - 1 to enable, 0 to disable
  * @return     : None
  *******************************************************************/
-void SH1106_SetPixel(uint8_t color, int16_t x, int16_t y)
+void SH1106_SetDoubleBuffer(uint8_t enable)
 {
-	if (x >= SH1106_WIDTH || y >= SH1106_HEIGHT || x < 0 || y < 0) return;
-
-	uint16_t index = (y / SH1106_DATA_SIZE) * SH1106_WIDTH + x;
-	uint8_t bitOffset = y % SH1106_DATA_SIZE;
-
-	if (color) SH1106_Buffer[index] |= (1 << bitOffset);
-	else SH1106_Buffer[index] &= ~(1 << bitOffset);
+	SH1106_WaitTransfer();
+	SH1106_DoubleBuffer = enable ? 1 : 0;
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawCharacter
- * @brief      : Draws a character in the buffer
- * @details    : Draws a character at the specified coordinates using the specified font
- * @parameters : color - Text color (1 = on, 0 = off)
- *               x - Starting horizontal position (in pixels)
- *               y - Starting vertical position (in pixels)
- *               font - Font used to draw the text
- *               letterNumberAscii - ASCII value of the character to draw
+ * @name       : SH1106_Invalidate
+ * @brief      : Forces a full refresh
+ * @details    : The next SH1106_SendBuffer sends the whole buffer 
+ *               whatever the display RAM copy contains
+ * @parameters : None
  * @return     : None
  *******************************************************************/
-void SH1106_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii)
+void SH1106_Invalidate(void)
 {
-	if (letterNumberAscii < font->asciiBegin || letterNumberAscii > font->asciiEnd) return;
-
-	uint8_t letterNumber = letterNumberAscii - font->asciiOffset;
-	uint16_t index_letterSize = letterNumber * font->datasize;
-	uint8_t letterSize = font->data[index_letterSize];
+	SH1106_FullRefresh = 1;
+}
 
-	for (int column = 0; column < letterSize; column++)
+/*******************************************************************
+ * @name       : SH1106_SetStartLine
+ * @brief      : Scrolls the screen vertically
+ * @details    : Selects the display RAM row shown on the first line: 
+ *               the image moves up by line rows and wraps around, 
+ *               at the cost of one command byte instead of a frame. 
+ *               Waits for the end of the current transfer first. 
+ *               During the start-up the line is only recorded, the 
+ *               screen configuration sends it.
+ * @parameters : line - Display RAM row (0 to 63)
+ * @return     : None
+ *******************************************************************/
+void SH1106_SetStartLine(uint8_t line)
+{
+	line %= SH1106_HEIGHT;
+	if (line == SH1106_StartLine) return;
+	if (!SH1106_Ready)
 	{
-		for (int byteColumn = 0; byteColumn < font->bytesPerColums; byteColumn++)
-		{
-			uint16_t index_Buffer = 1 + letterNumber * font->datasize + byteColumn + font->bytesPerColums * column;
-			uint8_t data = font->data[index_Buffer];
-			for (int bit = 0; bit < 8; bit++)
-			{
-				uint8_t pixel = (data >> bit) & 1;
-				int16_t a = x + column;
-				int16_t b = y + (bit + 8 * byteColumn);
-				if (pixel) SH1106_SetPixel(color, a, b);
-			}
-		}
+		SH1106_StartLine = line;          // Sent by the screen configuration
+		return;
 	}
+
+	SH1106_WaitTransfer();
+	SH1106_PORT_SendCmd(SH1106_CMD_STARTLINE | line);
+	SH1106_StartLine = line;
+	SH1106_Stats.totalBytes += 1;
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawStr
- * @brief      : Displays a string on the OLED screen
- * @details    : Draws a string starting from the specified 
- *               coordinates using the specified font
- * @parameters : color - Text color (1 = on, 0 = off)
- *               x - Starting horizontal position (in pixels)
- *               y - Starting vertical position (in pixels)
- *               font - Font used to draw the text
- *               format - String to be displayed
+ * @name       : SH1106_Scroll
+ * @brief      : Scrolls the screen by a number of rows
+ * @details    : Moves the start line relative to its current value
+ * @parameters : lines - Rows to scroll up (negative to scroll down)
  * @return     : None
  *******************************************************************/
-void SH1106_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format)
+void SH1106_Scroll(int8_t lines)
 {
-	while (*format && x < SH1106_WIDTH && y < SH1106_HEIGHT)
+	SH1106_SetStartLine((SH1106_StartLine + lines + SH1106_HEIGHT) % SH1106_HEIGHT);
+}
+
+/*******************************************************************
+ * @name       : SH1106_GetStartLine
+ * @brief      : Returns the current display start line
+ * @parameters : None
+ * @return     : Display RAM row shown on the first line
+ *******************************************************************/
+uint8_t SH1106_GetStartLine(void)
+{
+	return SH1106_StartLine;
+}
+
+/*******************************************************************
+ * @name       : SH1106_SetOffset
+ * @brief      : Shifts the whole image vertically
+ * @details    : Sets the display offset, independent of the start 
+ *               line used for scrolling. Small periodic offsets 
+ *               (pixel shifting) spread the wear of static content 
+ *               on the OLED. Waits for the end of the current 
+ *               transfer first. During the start-up the offset is 
+ *               only recorded, the screen configuration sends it.
+ * @parameters : offset - Rows to shift up (0 to 63, 63 shifts down by one)
+ * @return     : None
+ *******************************************************************/
+void SH1106_SetOffset(uint8_t offset)
+{
+	offset %= SH1106_HEIGHT;
+	if (offset == SH1106_Offset) return;
+	if (!SH1106_Ready)
 	{
-		uint8_t currentChar = *format;
+		SH1106_Offset = offset;           // Sent by the screen configuration
+		return;
+	}
 
-		SH1106_DrawCharacter(color, x, y, font, currentChar);
+	SH1106_WaitTransfer();
+	SH1106_SendDoubleCmd(SH1106_CMD_SETOFFS, offset);
+	SH1106_Offset = offset;
+	SH1106_Stats.totalBytes += 2;
+}
 
-		// Create a space between the letters
-		uint8_t letterNumber = currentChar - font->asciiOffset;
-		uint16_t index_letterSize = letterNumber * font->datasize;
-		uint8_t letterSize = font->data[index_letterSize];
-		x += letterSize + (font->length / 10);
+/*******************************************************************
+ * @name       : SH1106_GetStats
+ * @brief      : Returns the transfer counters
+ * @details    : Bytes, commands and windows sent for the last frame, 
+ *               total bytes and frames since initialization
+ * @parameters : None
+ * @return     : Pointer to the counters
+ *******************************************************************/
+const SH1106_StatsTypeDef *SH1106_GetStats(void)
+{
+	return &SH1106_Stats;
+}
 
-		// Go to next letter
-		format++;
-	}
+/*******************************************************************
+ * @name       : SH1106_IsBusy
+ * @brief      : Returns the state of the buffer transfer
+ * @parameters : None
+ * @return     : 1 if a transfer is in progress, 0 otherwise
+ *******************************************************************/
+uint8_t SH1106_IsBusy(void)
+{
+	return SH1106_TransferBusy;
 }
 
 /*******************************************************************
- * @name       : SH1106_FontPrint
- * @brief      : Prints a formatted string on the OLED screen
- * @details    : Draws a formatted string starting from the specified 
- *               coordinates using the specified font
- * @parameters : color - Text color (1 = on, 0 = off)
- *               x - Starting horizontal position (in pixels)
- *               y - Starting vertical position (in pixels)
- *               font - Font used to draw the text
- *               format - Formatted string to be displayed
+ * @name       : SH1106_WaitTransfer
+ * @brief      : Waits for the end of the buffer transfer
+ * @parameters : None
  * @return     : None
  *******************************************************************/
-void SH1106_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...)
+void SH1106_WaitTransfer(void)
 {
-	va_list args;
-	va_start(args, format);
-	char formatted_string[50];
-	vsprintf(formatted_string, format, args);
-	va_end(args);
+	while (SH1106_TransferBusy);
+}
 
-	SH1106_DrawStr(color, x, y, font, formatted_string);
+/*******************************************************************
+ * @name       : SH1106_SetTransferCallback
+ * @brief      : Sets the end of transfer callback
+ * @details    : The callback is called from the DMA interrupt once 
+ *               the last page has been sent. It is not called for a 
+ *               frame with no changed window, since nothing is sent
+ * @parameters : callback - Function to call (0 to disable)
+ * @return     : None
+ *******************************************************************/
+void SH1106_SetTransferCallback(SH1106_Callback callback)
+{
+	SH1106_TransferCallback = callback;
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawLine
- * @brief      : Draws a line on the OLED screen
- * @details    : Draws a line from (x0, y0) to (x1, y1)
- * @parameters : color - Line color (1 = on, 0 = off)
- *               x0 - Starting horizontal position (in pixels)
- *               y0 - Starting vertical position (in pixels)
- *               x1 - Ending horizontal position (in pixels)
- *               y1 - Ending vertical position (in pixels)
+ * @name       : SH1106_StreamComplete
+ * @brief      : Chains the transfers of a frame
+ * @details    : Called by the port at the end of each stream: sends 
+ *               the data after the address commands of a window, then 
+ *               the next window, until all the windows of the frame 
+ *               have been sent
+ * @parameters : error - 1 if the stream was aborted, 0 otherwise
  * @return     : None
  *******************************************************************/
-void SH1106_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+void SH1106_StreamComplete(uint8_t error)
 {
-	int dx = (x1 >= x0) ? x1 - x0 : x0 - x1;
-	int dy = (y1 >= y0) ? y1 - y0 : y0 - y1;
-	int sx = (x0 < x1) ? 1 : -1;
-	int sy = (y0 < y1) ? 1 : -1;
-	int err = dx - dy;
+	if (error)
+	{
+		// Transfer error: abort the frame
+		SH1106_TransferPhase = SH1106_PHASE_DATA;
+		SH1106_TransferWindow = SH1106_WindowCount - 1;
+		SH1106_FullRefresh = 1;
+	}
 
-	while(1)
+	if (SH1106_TransferPhase == SH1106_PHASE_CMD)
 	{
-		SH1106_SetPixel(color, x0, y0);
-		if (x0 == x1 && y0 == y1) break;
-		int e2 = err + err;
-		if (e2 > -dy)
-		{
-			err -= dy;
-			x0 += sx;
-		}
-		if (e2 < dx)
-		{
-			err += dx;
-			y0 += sy;
-		}
+		SH1106_PORT_SetMode(SH1106_PORT_DATA);
+		SH1106_TransferPhase = SH1106_PHASE_DATA;
+		uint8_t window = SH1106_TransferWindow;
+		SH1106_PORT_Stream(SH1106_WindowData[window], SH1106_WindowEnd[window] - SH1106_WindowStart[window] + 1);
+		return;
+	}
+
+	SH1106_PORT_End();
+
+	if (SH1106_TransferWindow + 1 < SH1106_WindowCount)
+	{
+		SH1106_StartWindow(SH1106_TransferWindow + 1);
+		return;
 	}
+
+	// End of frame
+	SH1106_PORT_Release();
+	SH1106_TransferBusy = 0;
+	if (SH1106_TransferCallback) SH1106_TransferCallback();
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawRectangle
- * @brief      : Draws a rectangle on the OLED screen
- * @details    : Draws a rectangle with the specified width and 
- *               height starting from the specified coordinates
- * @parameters : color - Rectangle color (1 = on, 0 = off)
- *               x - Starting horizontal position (in pixels)
- *               y - Starting vertical position (in pixels)
- *               w - Width of the rectangle (in pixels)
- *               h - Height of the rectangle (in pixels)
+ * @name       : SH1106_MarkDirty
+ * @brief      : Records a changed column range
+ * @details    : Extends the dirty column range of a page
+ * @parameters : page - Page number (0 to 7)
+ *               x0 - First changed column
+ *               x1 - Last changed column
  * @return     : None
  *******************************************************************/
-void SH1106_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+static void SH1106_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1)
 {
-	// Check input parameters
-	if (x >= SH1106_WIDTH || y >= SH1106_HEIGHT) return;
-
-	// Check width and height
-	if ((x + w) >= SH1106_WIDTH) w = SH1106_WIDTH - x;
-	if ((y + h) >= SH1106_HEIGHT) h = SH1106_HEIGHT - y;
-
-	// Draw 4 lines
-	SH1106_DrawLine(color, x, y, x + w, y);         // Top line
-	SH1106_DrawLine(color, x, y + h, x + w, y + h); // Bottom line
-	SH1106_DrawLine(color, x, y, x, y + h);         // Left line
-	SH1106_DrawLine(color, x + w, y, x + w, y + h); // Right line
+	if (x0 < SH1106_DirtyMin[page]) SH1106_DirtyMin[page] = x0;
+	if (x1 > SH1106_DirtyMax[page]) SH1106_DirtyMax[page] = x1;
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawFilledRectangle
- * @brief      : Draws a filled rectangle on the OLED screen
- * @details    : Draws a filled rectangle with the specified 
- *               width and height starting from the specified 
- *               coordinates
- * @parameters : color - Rectangle color (1 = on, 0 = off)
- *               x - Starting horizontal position (in pixels)
- *               y - Starting vertical position (in pixels)
- *               w - Width of the rectangle (in pixels)
- *               h - Height of the rectangle (in pixels)
+ * Page-major layout adapter of the rendering core (Inc/gfx_core.h): 
+ * a byte holds 8 rows of one column, LSB at the top
+ *******************************************************************/
+#define GFX_NAME(name) SH1106_##name
+#define GFX_WIDTH      SH1106_WIDTH
+#define GFX_HEIGHT     SH1106_HEIGHT
+#define GFX_VERTICAL   1
+#define GFX_COLOR_XOR  SH1106_COLOR_XOR
+
+/*******************************************************************
+ * @name       : SH1106_WritePixel
+ * @brief      : Writes a pixel in the display buffer
+ * @details    : Sets or clears a pixel inside the screen and records 
+ *               the column as dirty if the byte changed
+ * @parameters : color - Pixel color (1 = on, 0 = off, 2 = inverted)
+ *               x - Horizontal position (in pixels)
+ *               y - Vertical position (in pixels)
  * @return     : None
  *******************************************************************/
-void SH1106_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+static inline void SH1106_WritePixel(uint8_t color, int16_t x, int16_t y)
 {
-	// Check input parameters
-	if (x >= SH1106_WIDTH || y >= SH1106_HEIGHT) return;
+	SH1106_COUNT_OPS(1);
+	SH1106_SyncBuffer();
+
+	uint8_t page = y / SH1106_DATA_SIZE;
+	uint16_t index = page * SH1106_WIDTH + x;
+	uint8_t bitOffset = y % SH1106_DATA_SIZE;
+	uint8_t data = SH1106_Buffer[index];
 
-	// Check width and height
-	if ((x + w) >= SH1106_WIDTH) w = SH1106_WIDTH - x;
-	if ((y + h) >= SH1106_HEIGHT) h = SH1106_HEIGHT - y;
+	if (color == SH1106_COLOR_XOR) data ^= (1 << bitOffset);
+	else if (color) data |= (1 << bitOffset);
+	else data &= ~(1 << bitOffset);
 
-	// Draw lines
-	for (int i = 0; i <= h; i++)
-		SH1106_DrawLine(color, x, y + i, x + w, y + i);
+	if (data == SH1106_Buffer[index]) return;
+
+	SH1106_Buffer[index] = data;
+	SH1106_MarkDirty(page, x, x);
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawCircle
- * @brief      : Draws a circle on the OLED screen
- * @details    : Draws a circle with the specified radius centered 
- *               at (x0, y0)
- * @parameters : color - Circle color (1 = on, 0 = off)
- *               x0 - Horizontal center position (in pixels)
- *               y0 - Vertical center position (in pixels)
- *               radius - Radius of the circle (in pixels)
+ * @name       : SH1106_BlitGlyph
+ * @brief      : Merges a glyph into the buffer
+ * @details    : Font columns are LSB first like the pages: shifts each 
+ *               column byte to the page alignment and merges it into 
+ *               one or two pages
+ * @parameters : color - Text color (1 = on, 0 = off, 2 = inverted)
+ *               x - Left column of the stored glyph (in pixels)
+ *               y - Top row of the stored glyph (in pixels)
+ *               rows - Rows of the stored glyph inside the font height
+ *               data - Glyph column bytes
+ *               glyph - Glyph description
  * @return     : None
  *******************************************************************/
-void SH1106_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
+static void SH1106_BlitGlyph(uint8_t color, int16_t x, int16_t y, int16_t rows, const uint8_t *data, const FontGlyph *glyph)
 {
-    int x = radius;
-    int y = 0;
-    int err = 0;
-
-    SH1106_SetPixel(color, x0, y0 + radius);
-    SH1106_SetPixel(color, x0, y0 - radius);
-    SH1106_SetPixel(color, x0 + radius, y0);
-    SH1106_SetPixel(color, x0 - radius, y0);
-
-    while (x >= y)
-    {
-        SH1106_SetPixel(color, x0 + x, y0 + y);
-        SH1106_SetPixel(color, x0 - x, y0 + y);
-        SH1106_SetPixel(color, x0 + x, y0 - y);
-        SH1106_SetPixel(color, x0 - x, y0 - y);
-        SH1106_SetPixel(color, x0 + y, y0 + x);
-        SH1106_SetPixel(color, x0 - y, y0 + x);
-        SH1106_SetPixel(color, x0 + y, y0 - x);
-        SH1106_SetPixel(color, x0 - y, y0 - x);
-
-        y++;
-        err += 1 + 2*y;
-
-        if (2*(err - x) + 1 > 0)
-        {
-            x--;
-            err += 1 - 2*x;
-        }
-    }
+	SH1106_SyncBuffer();
+
+	uint8_t byteCount = glyph->byteCount;
+	uint8_t firstPage = y / SH1106_DATA_SIZE;
+	uint8_t lastPage = (y + rows - 1) / SH1106_DATA_SIZE;
+	uint8_t shift = y % SH1106_DATA_SIZE;
+
+	for (int column = 0; column < glyph->columns; column++)
+	{
+		uint8_t *buffer = &SH1106_Buffer[firstPage * SH1106_WIDTH + x + column];
+		const uint8_t *pixels = &data[byteCount * column];
+		uint8_t carry = 0;
+
+		for (int page = firstPage, byteColumn = 0; page <= lastPage; page++, byteColumn++)
+		{
+			uint8_t bits = (byteColumn < byteCount) ? pixels[byteColumn] : 0;
+			uint8_t mask = (bits << shift) | carry;
+			carry = shift ? bits >> (SH1106_DATA_SIZE - shift) : 0;
+
+			if (color == SH1106_COLOR_XOR) *buffer ^= mask;
+			else if (color) *buffer |= mask;
+			else *buffer &= ~mask;
+			buffer += SH1106_WIDTH;
+		}
+		SH1106_COUNT_OPS(lastPage - firstPage + 1);
+	}
+
+	for (int page = firstPage; page <= lastPage; page++)
+		SH1106_MarkDirty(page, x, x + glyph->columns - 1);
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawFilledCircle
- * @brief      : Draws a filled circle on the OLED screen
- * @details    : Draws a filled circle with the specified radius 
- *               centered at (x0, y0)
- * @parameters : color - Circle color (1 = on, 0 = off)
- *               x0 - Horizontal center position (in pixels)
- *               y0 - Vertical center position (in pixels)
- *               r - Radius of the circle (in pixels)
+ * @name       : SH1106_FillArea
+ * @brief      : Fills an area of the buffer
+ * @details    : Writes one precomputed page mask per column and per 
+ *               page: a horizontal span is one bit per column, a 
+ *               vertical span whole bytes except at both ends
+ * @parameters : color - Area color (1 = on, 0 = off, 2 = inverted)
+ *               x0 - Left column (in pixels)
+ *               y0 - Top row (in pixels)
+ *               x1 - Right column, included (in pixels)
+ *               y1 - Bottom row, included (in pixels)
  * @return     : None
  *******************************************************************/
-void SH1106_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r)
+static void SH1106_FillArea(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-	SH1106_SetPixel(color, x0, y0 + r);
-	SH1106_SetPixel(color, x0, y0 - r);
-	SH1106_SetPixel(color, x0 + r, y0);
-	SH1106_SetPixel(color, x0 - r, y0);
-	SH1106_DrawLine(color, x0 - r, y0, x0 + r, y0);
-
-	while (x < y)
+	SH1106_SyncBuffer();
+
+	// Clip to the screen
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 >= SH1106_WIDTH) x1 = SH1106_WIDTH - 1;
+	if (y1 >= SH1106_HEIGHT) y1 = SH1106_HEIGHT - 1;
+	if (x0 > x1 || y0 > y1) return;
+
+	uint8_t firstPage = y0 / SH1106_DATA_SIZE;
+	uint8_t lastPage = y1 / SH1106_DATA_SIZE;
+
+	for (uint8_t page = firstPage; page <= lastPage; page++)
 	{
-		if (f >= 0)
+		uint8_t mask = 0xFF;
+		if (page == firstPage) mask &= SH1106_MaskFrom[y0 % SH1106_DATA_SIZE];
+		if (page == lastPage) mask &= SH1106_MaskTo[y1 % SH1106_DATA_SIZE];
+
+		uint8_t *buffer = &SH1106_Buffer[page * SH1106_WIDTH + x0];
+		uint8_t *end = &SH1106_Buffer[page * SH1106_WIDTH + x1];
+
+		if (color == SH1106_COLOR_XOR) while (buffer <= end) *buffer++ ^= mask;
+		else if (color) while (buffer <= end) *buffer++ |= mask;
+		else while (buffer <= end) *buffer++ &= ~mask;
+
+		SH1106_MarkDirty(page, x0, x1);
+		SH1106_COUNT_OPS(x1 - x0 + 1);
+	}
+}
+
+/*******************************************************************
+ * @name       : SH1106_BlitStrip
+ * @brief      : Merges a decoded bitmap page into the buffer
+ * @details    : The strip bytes are columns like the pages: each one 
+ *               is shifted to the page alignment and merged into one 
+ *               or two pages, opaque (rows of the mask replaced), 
+ *               transparent (lit rows only) or XOR (lit rows inverted)
+ * @parameters : x - Left column (in pixels)
+ *               y - Top row of the strip (in pixels)
+ *               strip - Column bytes, LSB at the top
+ *               width - Number of columns
+ *               mask - Rows of the strip belonging to the bitmap
+ *               mode - BITMAP_OPAQUE, BITMAP_TRANSPARENT or BITMAP_XOR
+ * @return     : None
+ *******************************************************************/
+static void SH1106_BlitStrip(int16_t x, int16_t y, const uint8_t *strip, int16_t width, uint8_t mask, uint8_t mode)
+{
+	SH1106_SyncBuffer();
+
+	uint8_t shift = y & (SH1106_DATA_SIZE - 1);
+	int16_t page = (y - shift) / SH1106_DATA_SIZE;
+
+	// Upper part of the strip in the first page, lower part in the next one
+	for (uint8_t part = 0; part < 2; part++, page++)
+	{
+		uint8_t partShift = part ? SH1106_DATA_SIZE - shift : shift;
+		uint8_t partMask = part ? mask >> partShift : (uint8_t)(mask << partShift);
+		if (page < 0 || page >= SH1106_PAGES || !partMask) continue;
+
+		uint8_t *buffer = &SH1106_Buffer[page * SH1106_WIDTH + x];
+		for (int16_t column = 0; column < width; column++)
 		{
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
+			uint8_t bits = part ? (strip[column] & mask) >> partShift : (uint8_t)((strip[column] & mask) << partShift);
+
+			if (mode & BITMAP_XOR) buffer[column] ^= bits;
+			else if (mode & BITMAP_TRANSPARENT) buffer[column] |= bits;
+			else buffer[column] = (buffer[column] & ~partMask) | bits;
 		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
 
-		SH1106_DrawLine(color, x0 - x, y0 + y, x0 + x, y0 + y);
-		SH1106_DrawLine(color, x0 - x, y0 - y, x0 + x, y0 - y);
+		SH1106_MarkDirty(page, x, x + width - 1);
+		SH1106_COUNT_OPS(width);
+	}
+}
+
+#include "../Inc/gfx_core.h"
 
-		SH1106_DrawLine(color, x0 - y, y0 + x, x0 + y, y0 + x);
-		SH1106_DrawLine(color, x0 - y, y0 - x, x0 + y, y0 - x);
+/*******************************************************************
+ * @name       : SH1106_CopyPages
+ * @brief      : Copies a page-native bitmap into the buffer
+ * @details    : The bitmap is stored like the buffer, one byte per 
+ *               column and per page. Each page is merged through its 
+ *               mask (bits replaced by the bitmap), and only the 
+ *               columns whose byte really changed are recorded as 
+ *               dirty, so an unchanged copy costs no transfer
+ * @parameters : x - Left column (in pixels)
+ *               page - First page (0 to 7)
+ *               width - Width of the bitmap (in columns)
+ *               pages - Height of the bitmap (in pages)
+ *               data - Bitmap bytes, page after page
+ *               stride - Distance between two pages of the bitmap (in bytes)
+ *               masks - Mask of each page, 0 to replace whole pages
+ * @return     : None
+ *******************************************************************/
+void SH1106_CopyPages(int16_t x, uint8_t page, uint8_t width, uint8_t pages, const uint8_t *data, uint16_t stride, const uint8_t *masks)
+{
+	SH1106_SyncBuffer();
+
+	// Clip to the screen
+	int16_t first = (x < 0) ? -x : 0;
+	int16_t last = (x + width > SH1106_WIDTH) ? SH1106_WIDTH - x - 1 : width - 1;
+	if (page >= SH1106_PAGES || first > last) return;
+	if (page + pages > SH1106_PAGES) pages = SH1106_PAGES - page;
+
+	for (uint8_t n = 0; n < pages; n++, page++, data += stride)
+	{
+		uint8_t mask = masks ? masks[n] : 0xFF;
+		uint8_t *buffer = &SH1106_Buffer[page * SH1106_WIDTH + x];
+		int16_t changedMin = SH1106_WIDTH;
+		int16_t changedMax = -1;
+
+		for (int16_t column = first; column <= last; column++)
+		{
+			uint8_t byte = (buffer[column] & ~mask) | (data[column] & mask);
+			if (byte == buffer[column]) continue;
+
+			buffer[column] = byte;
+			if (column < changedMin) changedMin = column;
+			changedMax = column;
+		}
+		SH1106_COUNT_OPS(last - first + 1);
+
+		if (changedMax >= 0) SH1106_MarkDirty(page, x + changedMin, x + changedMax);
 	}
 }
 
 /*******************************************************************
  * @name       : SH1106_ClearBuffer
  * @brief      : Clears the display buffer
- * @details    : Sets all pixels in the buffer to off
+ * @details    : Same as SH1106_FillBuffer(SH1106_COLOR_OFF)
  * @parameters : None
  * @return     : None
  *******************************************************************/
 void SH1106_ClearBuffer(void)
 {
-	uint16_t bufferSize = (SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE;
-	for (int i=0; i<bufferSize; i++)
-		SH1106_Buffer[i] = 0;
+	SH1106_FillBuffer(SH1106_COLOR_OFF);
+}
+
+/*******************************************************************
+ * @name       : SH1106_FillBuffer
+ * @brief      : Sets all pixels of the display buffer
+ * @details    : Starts the fill by DMA2D and returns: the CPU can 
+ *               prepare the frame (format text, compute positions) 
+ *               meanwhile, the first access to the buffer waits for 
+ *               the end of the fill. All columns are recorded as 
+ *               dirty, SH1106_SendBuffer trims them to the columns 
+ *               that changed. Waits first for the end of the current 
+ *               transfer, unless double buffer mode is enabled
+ * @parameters : color - Pixel color (1 = on, 0 = off)
+ * @return     : None
+ *******************************************************************/
+void SH1106_FillBuffer(uint8_t color)
+{
+	if (!SH1106_DoubleBuffer) SH1106_WaitTransfer();
+
+	DMA2D_Fill(SH1106_Buffer, color ? 0xFF : 0x00, sizeof(SH1106_Buffer));
+	SH1106_BufferPending = 1;
+
+	for (uint8_t page = 0; page < SH1106_PAGES; page++)
+		SH1106_MarkDirty(page, 0, SH1106_WIDTH - 1);
+}
+
+/*******************************************************************
+ * @name       : SH1106_CopyBuffer
+ * @brief      : Replaces the display buffer with a frame
+ * @details    : Starts the copy by DMA2D and returns, like 
+ *               SH1106_FillBuffer. The frame must stay unchanged 
+ *               until the next drawing call or SH1106_SendBuffer.
+ * @parameters : frame - SH1106_WIDTH bytes per page, pages 0 to 7, 
+ *                       LSB at the top (layout of the display RAM)
+ * @return     : None
+ *******************************************************************/
+void SH1106_CopyBuffer(const uint8_t *frame)
+{
+	if (!SH1106_DoubleBuffer) SH1106_WaitTransfer();
+
+	DMA2D_Copy(SH1106_Buffer, frame, sizeof(SH1106_Buffer));
+	SH1106_BufferPending = 1;
+
+	for (uint8_t page = 0; page < SH1106_PAGES; page++)
+		SH1106_MarkDirty(page, 0, SH1106_WIDTH - 1);
 }
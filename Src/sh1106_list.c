@@ -0,0 +1,464 @@
+#include "../Inc/sh1106_list.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// Display list of the SH1106: drawing calls are recorded as compact
+// commands, then rasterized page by page into a 132 byte page buffer
+// and streamed to the display. Each command knows the pages it touches,
+// a page only replays the commands that intersect it.
+// The page rasterizer is the rendering core (Inc/gfx_core.h) compiled
+// against a one-page layout adapter.
+
+// Command types
+#define SH1106_LIST_TEXT        0
+#define SH1106_LIST_LINE        1
+#define SH1106_LIST_RECT        2
+#define SH1106_LIST_FILLED_RECT 3
+#define SH1106_LIST_CIRCLE      4
+#define SH1106_LIST_FILLED_CIRCLE 5
+#define SH1106_LIST_BITMAP      6
+
+typedef struct {
+	uint8_t type;
+	uint8_t color;      // Color, or mode of a bitmap
+	uint8_t pages;      // Pages touched by the primitive (bit n = page n)
+	uint8_t text;       // Offset of the string in the text pool
+	int16_t a, b, c, d; // Arguments of the primitive
+	const void *data;   // Font or bitmap
+} SH1106_LIST_CommandTypeDef;
+
+static SH1106_LIST_CommandTypeDef SH1106_LIST_Commands[SH1106_LIST_SIZE];
+static char SH1106_LIST_Text[SH1106_LIST_TEXT_SIZE];
+static uint16_t SH1106_LIST_TextUsed = 0;
+static SH1106_LIST_StatsTypeDef SH1106_LIST_Stats;
+
+// Two page buffers: one is rasterized while the other is streamed by DMA
+static uint8_t SH1106_LIST_Pages[2][SH1106_WIDTH];
+
+// Page being rasterized
+static uint8_t *SH1106_LIST_Buffer = SH1106_LIST_Pages[0];
+static int16_t SH1106_LIST_Top = 0;
+
+/*******************************************************************
+ * One-page layout adapter of the rendering core (Inc/gfx_core.h):
+ * page-major like the SH1106 buffer, everything outside the rows
+ * of the current page is discarded
+ *******************************************************************/
+#define GFX_NAME(name) SH1106_LIST_Page##name
+#define GFX_WIDTH      SH1106_WIDTH
+#define GFX_HEIGHT     SH1106_HEIGHT
+#define GFX_VERTICAL   1
+#define GFX_COLOR_XOR  SH1106_COLOR_XOR
+
+static inline void SH1106_LIST_Merge(uint8_t *byte, uint8_t color, uint8_t mask)
+{
+	if (color == SH1106_COLOR_XOR) *byte ^= mask;
+	else if (color) *byte |= mask;
+	else *byte &= ~mask;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_PageWritePixel
+ * @brief      : Writes a pixel in the page buffer
+ * @details    : Pixels outside the current page are discarded
+ * @parameters : color - Pixel color (1 = on, 0 = off, 2 = inverted)
+ *               x - Horizontal position (in pixels)
+ *               y - Vertical position (in pixels)
+ * @return     : None
+ *******************************************************************/
+static inline void SH1106_LIST_PageWritePixel(uint8_t color, int16_t x, int16_t y)
+{
+	int16_t row = y - SH1106_LIST_Top;
+	if (row < 0 || row >= SH1106_DATA_SIZE) return;
+
+	SH1106_LIST_Merge(&SH1106_LIST_Buffer[x], color, 1 << row);
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_PageBlitGlyph
+ * @brief      : Merges the part of a glyph in the current page
+ * @details    : Builds the page byte of each glyph column from the
+ *               two column bytes that overlap the page, as the
+ *               buffer blit does page after page
+ * @parameters : color - Text color (1 = on, 0 = off, 2 = inverted)
+ *               x - Left column of the stored glyph (in pixels)
+ *               y - Top row of the stored glyph (in pixels)
+ *               rows - Rows of the stored glyph inside the font height
+ *               data - Glyph column bytes
+ *               glyph - Glyph description
+ * @return     : None
+ *******************************************************************/
+static void SH1106_LIST_PageBlitGlyph(uint8_t color, int16_t x, int16_t y, int16_t rows, const uint8_t *data, const FontGlyph *glyph)
+{
+	int16_t page = SH1106_LIST_Top / SH1106_DATA_SIZE;
+	int16_t firstPage = y / SH1106_DATA_SIZE;
+	int16_t lastPage = (y + rows - 1) / SH1106_DATA_SIZE;
+	if (page < firstPage || page > lastPage) return;
+
+	uint8_t byteCount = glyph->byteCount;
+	uint8_t shift = y % SH1106_DATA_SIZE;
+	int16_t byteColumn = page - firstPage;
+
+	for (int column = 0; column < glyph->columns; column++)
+	{
+		const uint8_t *pixels = &data[byteCount * column];
+		uint8_t mask = 0;
+
+		if (byteColumn < byteCount) mask |= pixels[byteColumn] << shift;
+		if (shift && byteColumn > 0 && byteColumn - 1 < byteCount) mask |= pixels[byteColumn - 1] >> (SH1106_DATA_SIZE - shift);
+
+		SH1106_LIST_Merge(&SH1106_LIST_Buffer[x + column], color, mask);
+	}
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_PageFillArea
+ * @brief      : Fills the part of an area in the current page
+ * @details    : Clips the area to the screen and to the page rows,
+ *               then writes one mask per column
+ * @parameters : color - Area color (1 = on, 0 = off, 2 = inverted)
+ *               x0 - Left column (in pixels)
+ *               y0 - Top row (in pixels)
+ *               x1 - Right column, included (in pixels)
+ *               y1 - Bottom row, included (in pixels)
+ * @return     : None
+ *******************************************************************/
+static void SH1106_LIST_PageFillArea(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	int16_t bottom = SH1106_LIST_Top + SH1106_DATA_SIZE - 1;
+
+	// Clip to the screen and to the page
+	if (x0 < 0) x0 = 0;
+	if (y0 < SH1106_LIST_Top) y0 = SH1106_LIST_Top;
+	if (x1 >= SH1106_WIDTH) x1 = SH1106_WIDTH - 1;
+	if (y1 > bottom) y1 = bottom;
+	if (x0 > x1 || y0 > y1) return;
+
+	uint8_t mask = (uint8_t)(0xFF << (y0 - SH1106_LIST_Top)) & (0xFF >> (bottom - y1));
+
+	for (int16_t x = x0; x <= x1; x++)
+		SH1106_LIST_Merge(&SH1106_LIST_Buffer[x], color, mask);
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_PageBlitStrip
+ * @brief      : Merges the part of a bitmap page in the current page
+ * @details    : A strip covers two pages at most: the upper part of
+ *               the shifted strip lands in its first page, the lower
+ *               part in the next one
+ * @parameters : x - Left column (in pixels)
+ *               y - Top row of the strip (in pixels)
+ *               strip - Column bytes, LSB at the top
+ *               width - Number of columns
+ *               mask - Rows of the strip belonging to the bitmap
+ *               mode - BITMAP_OPAQUE, BITMAP_TRANSPARENT or BITMAP_XOR
+ * @return     : None
+ *******************************************************************/
+static void SH1106_LIST_PageBlitStrip(int16_t x, int16_t y, const uint8_t *strip, int16_t width, uint8_t mask, uint8_t mode)
+{
+	uint8_t shift = y & (SH1106_DATA_SIZE - 1);
+	int16_t part = (SH1106_LIST_Top - (y - shift)) / SH1106_DATA_SIZE;
+	if (part < 0 || part > 1 || (part && !shift)) return;
+
+	uint8_t partShift = part ? SH1106_DATA_SIZE - shift : shift;
+	uint8_t partMask = part ? mask >> partShift : (uint8_t)(mask << partShift);
+	uint8_t *buffer = &SH1106_LIST_Buffer[x];
+
+	for (int16_t column = 0; column < width; column++)
+	{
+		uint8_t bits = part ? (strip[column] & mask) >> partShift : (uint8_t)((strip[column] & mask) << partShift);
+
+		if (mode & BITMAP_XOR) buffer[column] ^= bits;
+		else if (mode & BITMAP_TRANSPARENT) buffer[column] |= bits;
+		else buffer[column] = (buffer[column] & ~partMask) | bits;
+	}
+}
+
+#include "../Inc/gfx_core.h"
+
+/*******************************************************************
+ * @name       : SH1106_LIST_Append
+ * @brief      : Appends a command to the display list
+ * @details    : Computes the pages crossed by the rows top to bottom;
+ *               a primitive outside the screen is not recorded
+ * @parameters : type - Command type
+ *               color - Color, or mode of a bitmap
+ *               top - First row touched (in pixels)
+ *               bottom - Last row touched (in pixels)
+ * @return     : The new command, 0 if it is not recorded
+ *******************************************************************/
+static SH1106_LIST_CommandTypeDef *SH1106_LIST_Append(uint8_t type, uint8_t color, int16_t top, int16_t bottom)
+{
+	if (top < 0) top = 0;
+	if (bottom >= SH1106_HEIGHT) bottom = SH1106_HEIGHT - 1;
+	if (top > bottom) return 0;
+
+	if (SH1106_LIST_Stats.commands >= SH1106_LIST_SIZE)
+	{
+		SH1106_LIST_Stats.dropped++;
+		return 0;
+	}
+
+	SH1106_LIST_CommandTypeDef *command = &SH1106_LIST_Commands[SH1106_LIST_Stats.commands++];
+	uint8_t first = top / SH1106_DATA_SIZE;
+	uint8_t last = bottom / SH1106_DATA_SIZE;
+
+	command->type = type;
+	command->color = color;
+	command->pages = (uint8_t)((0xFF << first) & (0xFF >> (SH1106_PAGES - 1 - last)));
+	return command;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_Begin
+ * @brief      : Starts a new display list
+ * @details    : Empties the list and the text pool
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_Begin(void)
+{
+	SH1106_LIST_Stats.commands = 0;
+	SH1106_LIST_Stats.dropped = 0;
+	SH1106_LIST_TextUsed = 0;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_FontPrint
+ * @brief      : Records a formatted string
+ * @details    : The string is formatted now and kept in the text pool
+ * @parameters : color - Text color (1 = on, 0 = off, 2 = inverted)
+ *               x - Starting horizontal position (in pixels)
+ *               y - Starting vertical position (in pixels)
+ *               font - Font used to draw the text
+ *               format - Formatted string to be displayed
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...)
+{
+	char text[50];
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(text, sizeof(text), format, args);
+	va_end(args);
+
+	uint16_t size = strlen(text) + 1;
+	if (SH1106_LIST_TextUsed + size > SH1106_LIST_TEXT_SIZE)
+	{
+		SH1106_LIST_Stats.dropped++;
+		return;
+	}
+
+	SH1106_LIST_CommandTypeDef *command = SH1106_LIST_Append(SH1106_LIST_TEXT, color, y, y + font->height - 1);
+	if (!command) return;
+
+	memcpy(&SH1106_LIST_Text[SH1106_LIST_TextUsed], text, size);
+	command->text = SH1106_LIST_TextUsed;
+	command->a = x;
+	command->b = y;
+	command->data = font;
+	SH1106_LIST_TextUsed += size;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_DrawLine
+ * @brief      : Records a line
+ * @parameters : color - Line color (1 = on, 0 = off, 2 = inverted)
+ *               x0, y0 - Starting position (in pixels)
+ *               x1, y1 - Ending position (in pixels)
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+	SH1106_LIST_CommandTypeDef *command = SH1106_LIST_Append(SH1106_LIST_LINE, color, (y0 < y1) ? y0 : y1, (y0 < y1) ? y1 : y0);
+	if (!command) return;
+
+	command->a = x0;
+	command->b = y0;
+	command->c = x1;
+	command->d = y1;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_DrawRectangle
+ * @brief      : Records a rectangle
+ * @parameters : color - Rectangle color (1 = on, 0 = off, 2 = inverted)
+ *               x, y - Starting position (in pixels)
+ *               w, h - Width and height of the rectangle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	SH1106_LIST_CommandTypeDef *command = SH1106_LIST_Append(SH1106_LIST_RECT, color, y, y + h);
+	if (!command) return;
+
+	command->a = x;
+	command->b = y;
+	command->c = w;
+	command->d = h;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_DrawFilledRectangle
+ * @brief      : Records a filled rectangle
+ * @parameters : color - Rectangle color (1 = on, 0 = off, 2 = inverted)
+ *               x, y - Starting position (in pixels)
+ *               w, h - Width and height of the rectangle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	SH1106_LIST_CommandTypeDef *command = SH1106_LIST_Append(SH1106_LIST_FILLED_RECT, color, y, y + h);
+	if (!command) return;
+
+	command->a = x;
+	command->b = y;
+	command->c = w;
+	command->d = h;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_DrawCircle
+ * @brief      : Records a circle
+ * @parameters : color - Circle color (1 = on, 0 = off, 2 = inverted)
+ *               x0, y0 - Center position (in pixels)
+ *               radius - Radius of the circle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
+{
+	SH1106_LIST_CommandTypeDef *command = SH1106_LIST_Append(SH1106_LIST_CIRCLE, color, y0 - radius, y0 + radius);
+	if (!command) return;
+
+	command->a = x0;
+	command->b = y0;
+	command->c = radius;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_DrawFilledCircle
+ * @brief      : Records a filled circle
+ * @parameters : color - Circle color (1 = on, 0 = off, 2 = inverted)
+ *               x0, y0 - Center position (in pixels)
+ *               r - Radius of the circle (in pixels)
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r)
+{
+	SH1106_LIST_CommandTypeDef *command = SH1106_LIST_Append(SH1106_LIST_FILLED_CIRCLE, color, y0 - r, y0 + r);
+	if (!command) return;
+
+	command->a = x0;
+	command->b = y0;
+	command->c = r;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_DrawBitmap
+ * @brief      : Records a bitmap
+ * @parameters : x, y - Top left position (in pixels)
+ *               bitmap - Run-length encoded bitmap
+ *               mode - Drawing mode (BITMAP_xxx)
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_DrawBitmap(int16_t x, int16_t y, const Bitmap *bitmap, uint8_t mode)
+{
+	SH1106_LIST_CommandTypeDef *command = SH1106_LIST_Append(SH1106_LIST_BITMAP, mode, y, y + bitmap->height - 1);
+	if (!command) return;
+
+	command->a = x;
+	command->b = y;
+	command->data = bitmap;
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_Replay
+ * @brief      : Rasterizes one command into the current page
+ * @parameters : command - Command to rasterize
+ * @return     : None
+ *******************************************************************/
+static void SH1106_LIST_Replay(const SH1106_LIST_CommandTypeDef *command)
+{
+	uint8_t color = command->color;
+
+	switch (command->type)
+	{
+		case SH1106_LIST_TEXT:
+			SH1106_LIST_PageDrawStr(color, command->a, command->b, command->data, &SH1106_LIST_Text[command->text]);
+			break;
+		case SH1106_LIST_LINE:
+			SH1106_LIST_PageDrawLine(color, command->a, command->b, command->c, command->d);
+			break;
+		case SH1106_LIST_RECT:
+			SH1106_LIST_PageDrawRectangle(color, command->a, command->b, command->c, command->d);
+			break;
+		case SH1106_LIST_FILLED_RECT:
+			SH1106_LIST_PageDrawFilledRectangle(color, command->a, command->b, command->c, command->d);
+			break;
+		case SH1106_LIST_CIRCLE:
+			SH1106_LIST_PageDrawCircle(color, command->a, command->b, command->c);
+			break;
+		case SH1106_LIST_FILLED_CIRCLE:
+			SH1106_LIST_PageDrawFilledCircle(color, command->a, command->b, command->c);
+			break;
+		case SH1106_LIST_BITMAP:
+			SH1106_LIST_PageDrawBitmap(command->a, command->b, command->data, color);
+			break;
+	}
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_Render
+ * @brief      : Rasterizes the display list and sends it
+ * @details    : For each page, clears a page buffer, replays in order
+ *               the commands whose rows cross the page and starts its
+ *               transfer; the next page is rasterized in the other
+ *               page buffer meanwhile. The list is kept, it can be
+ *               rendered again. The display buffer is not used: the
+ *               next SH1106_SendBuffer sends the whole buffer.
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void SH1106_LIST_Render(void)
+{
+	SH1106_LIST_Stats.replayed = 0;
+	SH1106_LIST_Stats.culled = 0;
+
+	for (uint8_t page = 0; page < SH1106_PAGES; page++)
+	{
+		// This buffer was sent two pages ago, SH1106_SendPage waited for it
+		SH1106_LIST_Buffer = SH1106_LIST_Pages[page & 1];
+		SH1106_LIST_Top = page * SH1106_DATA_SIZE;
+		memset(SH1106_LIST_Buffer, 0, SH1106_WIDTH);
+
+		for (uint16_t n = 0; n < SH1106_LIST_Stats.commands; n++)
+		{
+			const SH1106_LIST_CommandTypeDef *command = &SH1106_LIST_Commands[n];
+
+			if (!((command->pages >> page) & 1))
+			{
+				SH1106_LIST_Stats.culled++;
+				continue;
+			}
+
+			SH1106_LIST_Replay(command);
+			SH1106_LIST_Stats.replayed++;
+		}
+
+		SH1106_SendPage(page, SH1106_LIST_Buffer);
+	}
+}
+
+/*******************************************************************
+ * @name       : SH1106_LIST_GetStats
+ * @brief      : Returns the display list counters
+ * @parameters : None
+ * @return     : Pointer to the counters
+ *******************************************************************/
+const SH1106_LIST_StatsTypeDef *SH1106_LIST_GetStats(void)
+{
+	return &SH1106_LIST_Stats;
+}
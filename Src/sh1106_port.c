@@ -0,0 +1,307 @@
+#include "../Inc/sh1106_port.h"
+
+static void SH1106_PORT_GPIO_Init(void);
+static void SH1106_PORT_SPI1_Init(void);
+static void SH1106_PORT_DMA_Init(void);
+static void SH1106_PORT_SpiTransmit(uint8_t msg);
+static void SH1106_PORT_WaitSpiIdle(void);
+
+/*******************************************************************
+ * @name       : SH1106_PORT_GPIO_Init
+ * @brief      : Initializes GPIO for SH1106 display
+ * @details    : Configures GPIO pins for DC, CS, RST, SCK, and MOSI
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+static void SH1106_PORT_GPIO_Init(void)
+{
+	// Enable clock for GPIOA and GPIOC
+	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN;  // Enable clock for GPIOA
+	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN;  // Enable clock for GPIOC
+
+	// PA0-DC (GPIOA pin 0)
+	GPIOA->MODER |= GPIO_MODER_MODER0_0;  // Configure as output mode
+	GPIOA->MODER &= ~GPIO_MODER_MODER0_1; // Reset bits to configure as output
+
+	// PC0-CS (GPIOC pin 0)
+	GPIOC->MODER |= GPIO_MODER_MODER0_0;  // Configure as output mode
+	GPIOC->MODER &= ~GPIO_MODER_MODER0_1; // Reset bits to configure as output
+
+	// PC1-RST (GPIOC pin 1)
+	GPIOC->MODER |= GPIO_MODER_MODER1_0;  // Configure as output mode
+	GPIOC->MODER &= ~GPIO_MODER_MODER1_1; // Reset bits to configure as output
+
+	// PA5-SCK (GPIOA pin 5)
+	GPIOA->MODER |= GPIO_MODER_MODER5_1;  // Configure as alternate function (SCK)
+	GPIOA->MODER &= ~GPIO_MODER_MODER5_0; // Reset bits to configure as alternate function
+	GPIOA->AFR[0] |= SH1106_SPI1_AF << GPIO_AFRL_AFRL5_Pos; // Configure PA5 for SPI1
+
+	// PA7-MOSI (GPIOA pin 7)
+	GPIOA->MODER |= GPIO_MODER_MODER7_1;  // Configure as alternate function (MOSI)
+	GPIOA->MODER &= ~GPIO_MODER_MODER7_0; // Reset bits to configure as alternate function
+	GPIOA->AFR[0] |= SH1106_SPI1_AF << GPIO_AFRL_AFRL7_Pos; // Configure PA7 for SPI1
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_SPI1_Init
+ * @brief      : Initializes SPI1 for SH1106 display
+ * @details    : Configures SPI1 in master mode with specific settings
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+static void SH1106_PORT_SPI1_Init(void)
+{
+	// Enable clock for the SPI1 module
+	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+
+	// SPI1 configuration
+	// Set MSB first
+	SPI1->CR1 &= ~SPI_CR1_LSBFIRST;
+
+	// Configure SPI as MASTER
+	SPI1->CR1 |= SPI_CR1_MSTR;
+
+	// Select software slave management (SSM=1, SSI=1)
+	SPI1->CR1 |= SPI_CR1_SSM;
+	SPI1->CR1 |= SPI_CR1_SSI;
+
+	// Configure SPI mode (MODE1: CPHA=0, CPOL=0)
+	SPI1->CR1 &= ~SPI_CR1_CPHA;
+	SPI1->CR1 &= ~SPI_CR1_CPOL;
+
+	// Set SPI frequency to 500 kHz
+	SPI1->CR1 |= SPI_CR1_BR_2;
+
+	// Enable the SPI module
+	SPI1->CR1 |= SPI_CR1_SPE;
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_DMA_Init
+ * @brief      : Initializes DMA2 for SPI1 transmission
+ * @details    : Configures DMA2 Stream3 Channel3 (SPI1_TX) in 
+ *               memory-to-peripheral mode with byte transfers
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+static void SH1106_PORT_DMA_Init(void)
+{
+	// Enable clock for DMA2
+	RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+
+	// Disable the stream before configuration
+	SH1106_DMA_STREAM->CR &= ~DMA_SxCR_EN;
+	while (SH1106_DMA_STREAM->CR & DMA_SxCR_EN);
+
+	// Peripheral address is the SPI1 data register
+	SH1106_DMA_STREAM->PAR = (uint32_t)&SPI1->DR;
+
+	// Channel 3, memory increment, memory-to-peripheral, byte size, transfer complete and error interrupts
+	SH1106_DMA_STREAM->CR = (SH1106_DMA_CHANNEL << DMA_SxCR_CHSEL_Pos) | DMA_SxCR_MINC | DMA_SxCR_DIR_0 | DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+
+	// Direct mode (FIFO disabled)
+	SH1106_DMA_STREAM->FCR &= ~DMA_SxFCR_DMDIS;
+
+	NVIC_SetPriority(DMA2_Stream3_IRQn, 5);
+	NVIC_EnableIRQ(DMA2_Stream3_IRQn);
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_Init
+ * @brief      : Initializes the SH1106 transport
+ * @details    : Configures the GPIO, SPI1 and its TX DMA stream
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void SH1106_PORT_Init(void)
+{
+	SH1106_PORT_GPIO_Init();
+	SH1106_PORT_SPI1_Init();
+	SH1106_PORT_DMA_Init();
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_ResetStep
+ * @brief      : Runs one step of the hardware reset of the display
+ * @details    : RST high for 100 ms, low for 100 ms, then high;
+ *               SH1106_InitStep waits between the steps
+ * @parameters : None
+ * @return     : Milliseconds to wait before the next step, 0 when the
+ *               reset is over
+ *******************************************************************/
+uint32_t SH1106_PORT_ResetStep(void)
+{
+	static uint8_t step = 0;
+
+	switch (step++)
+	{
+		case 0:
+			SH1106_RST_HIGH;
+			return 100;
+
+		case 1:
+			SH1106_RST_LOW;
+			return 100;
+
+		default:
+			SH1106_RST_HIGH;
+			step = 0;
+			return 0;
+	}
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_SpiTransmit
+ * @brief      : Transmits data via SPI
+ * @details    : Sends a byte of data through the SPI interface
+ * @parameters : msg - Data byte to transmit
+ * @return     : None
+ *******************************************************************/
+static void SH1106_PORT_SpiTransmit(uint8_t msg)
+{
+	while (!(SPI1->SR & SPI_SR_TXE));    // Wait until TXE is set or timeout occurs
+	*(volatile uint8_t*) & SPI1->DR = msg; // Write the data to the data register
+	while (!(SPI1->SR & SPI_SR_TXE));    // Wait until TXE is set or timeout occurs
+	while ((SPI1->SR & SPI_SR_BSY));     // Wait for BUSY flag to reset or timeout occurs
+
+	// Clear OVR flag (Overrun flag) by reading DR and SR registers
+	(void)SPI1->DR;
+	(void)SPI1->SR;
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_SendCmd
+ * @brief      : Sends a command to the SH1106 display
+ * @details    : Transmits a command byte to the display
+ * @parameters : cmd - Command byte to send
+ * @return     : None
+ *******************************************************************/
+void SH1106_PORT_SendCmd(uint8_t cmd)
+{
+	SH1106_DC_LOW; // Command mode
+	SH1106_CS_LOW;
+	SH1106_PORT_SpiTransmit(cmd);
+	SH1106_CS_HIGH;
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_WaitSpiIdle
+ * @brief      : Waits for the end of the current SPI transmission
+ * @details    : Waits until the TX FIFO is empty and the last byte 
+ *               has left the shift register, then clears OVR
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+static void SH1106_PORT_WaitSpiIdle(void)
+{
+	while (SPI1->SR & SPI_SR_FTLVL);     // Wait until TX FIFO is empty
+	while (SPI1->SR & SPI_SR_BSY);       // Wait for BUSY flag to reset
+
+	// Clear OVR flag (Overrun flag) by reading DR and SR registers
+	(void)SPI1->DR;
+	(void)SPI1->SR;
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_Begin
+ * @brief      : Starts a streamed transfer
+ * @details    : Enables the SPI1 TX DMA requests, selects the byte 
+ *               mode and pulls CS low
+ * @parameters : mode - SH1106_PORT_CMD or SH1106_PORT_DATA
+ * @return     : None
+ *******************************************************************/
+void SH1106_PORT_Begin(uint8_t mode)
+{
+	SPI1->CR2 |= SPI_CR2_TXDMAEN;
+	SH1106_PORT_SetMode(mode);
+	SH1106_CS_LOW;
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_SetMode
+ * @brief      : Selects the byte mode
+ * @details    : Drives DC, only between two streams
+ * @parameters : mode - SH1106_PORT_CMD or SH1106_PORT_DATA
+ * @return     : None
+ *******************************************************************/
+void SH1106_PORT_SetMode(uint8_t mode)
+{
+	if (mode == SH1106_PORT_DATA) SH1106_DC_HIGH; // Data mode
+	else SH1106_DC_LOW; // Command mode
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_Stream
+ * @brief      : Starts a DMA transfer to SPI1
+ * @details    : Reloads DMA2 Stream3 with a new memory block and 
+ *               enables it, SH1106_StreamComplete is called from 
+ *               the DMA interrupt once the bytes have been sent
+ * @parameters : data - Bytes to transmit
+ *               size - Number of bytes to transmit
+ * @return     : None
+ *******************************************************************/
+void SH1106_PORT_Stream(const uint8_t *data, uint16_t size)
+{
+	SH1106_DMA_STREAM->CR &= ~DMA_SxCR_EN;
+	while (SH1106_DMA_STREAM->CR & DMA_SxCR_EN);
+
+	// Clear all Stream3 flags
+	DMA2->LIFCR = DMA_LIFCR_CTCIF3 | DMA_LIFCR_CHTIF3 | DMA_LIFCR_CTEIF3 | DMA_LIFCR_CDMEIF3 | DMA_LIFCR_CFEIF3;
+
+	SH1106_DMA_STREAM->M0AR = (uint32_t)data;
+	SH1106_DMA_STREAM->NDTR = size;
+	SH1106_DMA_STREAM->CR |= DMA_SxCR_EN;
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_End
+ * @brief      : Ends a streamed transfer
+ * @details    : Pulls CS high
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void SH1106_PORT_End(void)
+{
+	SH1106_CS_HIGH;
+}
+
+/*******************************************************************
+ * @name       : SH1106_PORT_Release
+ * @brief      : Releases the SPI after the last transfer
+ * @details    : Disables the SPI1 TX DMA requests
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void SH1106_PORT_Release(void)
+{
+	SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
+}
+
+/*******************************************************************
+ * @name       : DMA2_Stream3_IRQHandler
+ * @brief      : Handles the SPI1 TX DMA interrupts
+ * @details    : Waits for the last bytes to leave the SPI, then hands 
+ *               the end of the stream over to the driver
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+void DMA2_Stream3_IRQHandler(void)
+{
+	uint8_t error = 0;
+
+	if (DMA2->LISR & DMA_LISR_TEIF3)
+	{
+		DMA2->LIFCR = DMA_LIFCR_CTEIF3;
+		error = 1;
+	}
+	else if (DMA2->LISR & DMA_LISR_TCIF3)
+	{
+		DMA2->LIFCR = DMA_LIFCR_CTCIF3;
+	}
+	else return;
+
+	// The last bytes are still in the FIFO, DC and CS must not move before the end
+	SH1106_PORT_WaitSpiIdle();
+
+	SH1106_StreamComplete(error);
+}
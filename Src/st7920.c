@@ -1,90 +1,77 @@
 #include "../Inc/st7920.h"
+#include "../Inc/st7920_port.h"
 #include "../Inc/tim.h"
+#include "../Inc/dma2d.h"
 
 #include <stdarg.h>
 #include <stdio.h>
 
-/*******************************************************************
- * @name       :ST7920_SpiInit
- * @function   :SPI Initialization
- * @parameters :None
- * @retvalue   :None
- *******************************************************************/
-static void ST7920_SpiInit(void)
-{
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN; // enable clock for GPIOA
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN; // enable clock for GPIOC
+// Set while the extended instruction set with graphic display is on
+static uint8_t Graphic_Check = 0;
 
-	// Initialization of pin PA0-DC
-	GPIOA->MODER |= GPIO_MODER_MODER0_0;
-	GPIOA->MODER &= ~GPIO_MODER_MODER0_1;
+// Buffer for display data
+static uint8_t ST7920_Buffer[(ST7920_WIDTH * ST7920_HEIGHT) / ST7920_DATA_SIZE] __ALIGNED(4);
 
-	// Initialization of pin PC0-CS
-	GPIOC->MODER |= GPIO_MODER_MODER0_0;
-	GPIOC->MODER &= ~GPIO_MODER_MODER0_1;
+// Copy of the GDRAM, rows equal to the buffer are not sent again
+static uint8_t ST7920_Front[(ST7920_WIDTH * ST7920_HEIGHT) / ST7920_DATA_SIZE];
+static uint8_t ST7920_FullRefresh = 1;
 
-	// Initialization of pin PC1-RST
-	GPIOC->MODER |= GPIO_MODER_MODER1_0;
-	GPIOC->MODER &= ~GPIO_MODER_MODER1_1;
+// Set while a DMA2D fill or copy of the buffer may still be running
+static uint8_t ST7920_BufferPending = 0;
 
-	// Initialization of pin PA5-SCK
-	GPIOA->MODER |= GPIO_MODER_MODER5_1;
-	GPIOA->MODER &= ~GPIO_MODER_MODER5_0;
+// Time the last frame was queued, the next one waits for its execution
+static uint32_t ST7920_LastFrame = 0;
 
-	// Initialization of pin PA7-MOSI
-	GPIOA->MODER |= GPIO_MODER_MODER7_1;
-	GPIOA->MODER &= ~GPIO_MODER_MODER7_0;
+// Initialization state (ST7920_InitStep), frames wait for the last step
+static uint8_t ST7920_InitState = 0;
+static uint8_t ST7920_Ready = 0;
 
-	GPIOA->AFR[0] |= ST7920_SPI1_AF << GPIO_AFRL_AFRL5_Pos;
-	GPIOA->AFR[0] |= ST7920_SPI1_AF << GPIO_AFRL_AFRL7_Pos;
+// Text overlay: characters to show in DDRAM, and the DDRAM copy
+static char ST7920_Text[ST7920_TEXT_ROWS][ST7920_TEXT_COLUMNS];
+static char ST7920_TextFront[ST7920_TEXT_ROWS][ST7920_TEXT_COLUMNS];
+static const uint8_t ST7920_TextLine[ST7920_TEXT_ROWS] = {ST7920_CMD_LINE0, ST7920_CMD_LINE1, ST7920_CMD_LINE2, ST7920_CMD_LINE3};
 
-	//Enable clock access to SPI1 module
-	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+static void ST7920_SendText(void);
 
-	//Set MSB first
-	SPI1->CR1 &= ~SPI_CR1_LSBFIRST;
-
-	//Set mode to MASTER
-	SPI1->CR1 |= SPI_CR1_MSTR;
-
-	//Select software slave management by setting SSM=1 and SSI=1
-	SPI1->CR1 |= SPI_CR1_SSM;
-	SPI1->CR1 |= SPI_CR1_SSI;
-
-	//Set SPI mode to be MODE1 (CPHA0 CPOL0)
-	SPI1->CR1 |= SPI_CR1_CPHA;
-	SPI1->CR1 &= ~SPI_CR1_CPOL;
+// Waits for the fill or copy of the buffer before touching it
+static inline void ST7920_SyncBuffer(void)
+{
+	if (!ST7920_BufferPending) return;
+	DMA2D_Wait();
+	ST7920_BufferPending = 0;
+}
 
-	//Set the frequency of SPI to 500kHz
-	SPI1->CR1 |= SPI_CR1_BR_2;
+// Byte masks (MSB first): columns from n to the end of the byte, columns from the start of the byte to n
+static const uint8_t ST7920_MaskFrom[ST7920_DATA_SIZE] = {0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01};
+static const uint8_t ST7920_MaskTo[ST7920_DATA_SIZE] = {0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF};
 
-	//Enable SPI module
-	SPI1->CR1 |= SPI_CR1_SPE;
-}                                                  
+// Buffer write counter, enabled by the host benchmarks (Host/Makefile)
+#ifdef ST7920_PROFILE
+uint32_t ST7920_PixelOps = 0;
+#define ST7920_COUNT_OPS(n) (ST7920_PixelOps += (n))
+#else
+#define ST7920_COUNT_OPS(n)
+#endif
 
 /*******************************************************************
- * @name       :ST7920_SpiTransmit
- * @function   :Send with spi
- * @parameters :data
+ * @name       :ST7920_WriteFrame
+ * @function   :Queue a 24-bit serial frame: sync byte, high nibble, 
+ *              low nibble. Waits first until ST7920_EXEC_US have 
+ *              passed since the previous frame was queued: the frame 
+ *              fits in the TX FIFO and leaves the wire before the 
+ *              controller is done, so frames are ST7920_EXEC_US apart
+ * @parameters :sync (ST7920_CMD or ST7920_DATA), value
  * @retvalue   :None
  *******************************************************************/
-static void ST7920_SpiTransmit(uint8_t msg)
+static void ST7920_WriteFrame(uint8_t sync, uint8_t value)
 {
-	//Wait until TXE is set
-	while(!(SPI1->SR & (SPI_SR_TXE)));
-
-	//Write the data to the data register
-	*(volatile uint8_t*) & SPI1->DR = msg;
-			
-	//Wait until TXE is set
-	while(!(SPI1->SR & (SPI_SR_TXE)));
+	uint32_t elapsed = TIM_GetMicroseconds() - ST7920_LastFrame;
+	if (elapsed < ST7920_EXEC_US) TIM_WaitMicroseconds(ST7920_EXEC_US - elapsed);
+	ST7920_LastFrame = TIM_GetMicroseconds();
 
-	//Wait for BUSY flag to reset
-	while((SPI1->SR & (SPI_SR_BSY)));
-
-	//Clear OVR flag
-	(void)SPI1->DR;
-	(void)SPI1->SR;
+	ST7920_PORT_Write(sync);
+	ST7920_PORT_Write(value & ST7920_FOUR_STRONG_BITS);
+	ST7920_PORT_Write((value<<4) & ST7920_FOUR_STRONG_BITS);
 }
 
 /*******************************************************************
@@ -95,11 +82,9 @@ static void ST7920_SpiTransmit(uint8_t msg)
  *******************************************************************/
 static void ST7920_SendCmd(uint8_t cmd)
 {
-	ST7920_CS_HIGH;  
-	ST7920_SpiTransmit(ST7920_CMD);
-	ST7920_SpiTransmit(cmd & ST7920_FOUR_STRONG_BITS);
-	ST7920_SpiTransmit((cmd<<4) & ST7920_FOUR_STRONG_BITS);
-	ST7920_CS_LOW;  
+	ST7920_PORT_Select();
+	ST7920_WriteFrame(ST7920_CMD, cmd);
+	ST7920_PORT_Deselect();
 }
 
 /*******************************************************************
@@ -110,11 +95,9 @@ static void ST7920_SendCmd(uint8_t cmd)
  *******************************************************************/
 static void ST7920_SendData (uint8_t data)
 {
-	ST7920_CS_HIGH;  
-	ST7920_SpiTransmit(ST7920_DATA);
-	ST7920_SpiTransmit(data & ST7920_FOUR_STRONG_BITS);
-	ST7920_SpiTransmit((data<<4) & ST7920_FOUR_STRONG_BITS);
-	ST7920_CS_LOW;  
+	ST7920_PORT_Select();
+	ST7920_WriteFrame(ST7920_DATA, data);
+	ST7920_PORT_Deselect();
 }
 
 /*******************************************************************
@@ -148,6 +131,91 @@ void ST7920_SendString(int row, int col, char* string)
 	while (*string) ST7920_SendData(*string++);
 }
 
+/*******************************************************************
+ * @name       :ST7920_TextPrint
+ * @function   :Print formatted text in the text overlay, with the 
+ *              8x16 characters of the controller ROM. The controller 
+ *              shows it over the GDRAM, only the changed characters 
+ *              are sent by ST7920_SendBuffer.
+ * @parameters :row (0 to 3), column (0 to 15), format, ...
+ * @retvalue   :None
+ *******************************************************************/
+void ST7920_TextPrint(uint8_t row, uint8_t column, const char *format, ...)
+{
+	char string[ST7920_TEXT_COLUMNS + 1];
+
+	if (row >= ST7920_TEXT_ROWS) return;
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(string, sizeof(string), format, args);
+	va_end(args);
+
+	for (char *c = string; *c && column < ST7920_TEXT_COLUMNS; c++, column++)
+		ST7920_Text[row][column] = *c;
+}
+
+/*******************************************************************
+ * @name       :ST7920_TextClear
+ * @function   :Clear the text overlay (spaces)
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void ST7920_TextClear(void)
+{
+	for (uint8_t row = 0; row < ST7920_TEXT_ROWS; row++)
+		for (uint8_t column = 0; column < ST7920_TEXT_COLUMNS; column++)
+			ST7920_Text[row][column] = ' ';
+}
+
+/*******************************************************************
+ * @name       :ST7920_SendText
+ * @function   :Send the changed characters of the text overlay: one 
+ *              DDRAM address per row then the changed words, in the 
+ *              basic instruction set. Graphic mode is restored after.
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void ST7920_SendText(void)
+{
+	uint8_t basic = 0;
+
+	for (uint8_t row = 0; row < ST7920_TEXT_ROWS; row++)
+	{
+		const char *text = ST7920_Text[row];
+		char *front = ST7920_TextFront[row];
+		int8_t start = 0;
+		int8_t end = ST7920_TEXT_COLUMNS - 1;
+
+		while (start <= end && text[start] == front[start]) start++;
+		while (end >= start && text[end] == front[end]) end--;
+		if (start > end) continue;
+
+		// A DDRAM address holds two characters
+		start &= ~1;
+		end |= 1;
+
+		if (!basic && Graphic_Check)
+		{
+			// DDRAM addresses need the basic instruction set, the G bit is kept
+			ST7920_SendCmd(ST7920_CMD_BASIC);
+			basic = 1;
+		}
+
+		ST7920_PORT_Select();
+		ST7920_WriteFrame(ST7920_CMD, ST7920_TextLine[row] | (start / 2));
+		for (int8_t n = start; n <= end; n++)
+		{
+			ST7920_WriteFrame(ST7920_DATA, text[n]);
+			front[n] = text[n];
+		}
+		ST7920_PORT_Deselect();
+	}
+
+	// Back to the extended instruction set for the GDRAM addresses
+	if (basic) ST7920_SendCmd(ST7920_CMD_GFXMODE);
+}
+
 /*******************************************************************
  * @name       :ST7920_GraphicMode
  * @function   :Select graphic mode
@@ -159,347 +227,373 @@ void ST7920_GraphicMode(int enable)
 	if (enable)
 	{
 		ST7920_SendCmd(ST7920_CMD_BASIC);
-		TIM1_WaitMilliseconds(1);
+		TIM_WaitMilliseconds(1);
 		ST7920_SendCmd(ST7920_CMD_EXTEND);
-		TIM1_WaitMilliseconds(1);
+		TIM_WaitMilliseconds(1);
 		ST7920_SendCmd(ST7920_CMD_GFXMODE);
-		TIM1_WaitMilliseconds(1);
+		TIM_WaitMilliseconds(1);
 		Graphic_Check = 1;
+		ST7920_FullRefresh = 1;
 	}
 	else 
 	{
 		ST7920_SendCmd(ST7920_CMD_BASIC);
-		TIM1_WaitMilliseconds(1);
+		TIM_WaitMilliseconds(1);
 		Graphic_Check = 0;
 	}
 }
 
 /*******************************************************************
  * @name       :ST7920_SendBuffer
- * @function   :Select graphic mode
- * @parameters :enable (1 or 0)
+ * @function   :Send the buffer to the GDRAM, row by row: the address 
+ *              is set once per row, then the changed words of the row 
+ *              are written with the GDRAM address auto-increment. 
+ *              Rows equal to the GDRAM copy are skipped. The changed 
+ *              characters of the text overlay follow. Nothing is 
+ *              sent before the end of the initialization. 
+ *              Every frame takes ST7920_EXEC_US: a row costs 2 address 
+ *              frames plus 2 per changed word, a full refresh 1152 
+ *              frames (about 83ms).
+ * @parameters :None
  * @retvalue   :None
  *******************************************************************/
 void ST7920_SendBuffer(void)
 {
-	for (uint8_t y = 0; y < 64; y++)
+	const uint8_t rowSize = ST7920_WIDTH / ST7920_DATA_SIZE;
+
+	if (!ST7920_Ready) return;
+
+	ST7920_SyncBuffer();
+
+	for (uint8_t y = 0; y < ST7920_HEIGHT; y++)
 	{
+		const uint8_t *buffer = &ST7920_Buffer[y * rowSize];
+		uint8_t *front = &ST7920_Front[y * rowSize];
+		int8_t start = 0;
+		int8_t end = rowSize - 1;
+
+		if (!ST7920_FullRefresh)
+		{
+			// Trim the row to the words that differ from the GDRAM
+			while (start <= end && buffer[start] == front[start]) start++;
+			while (end >= start && buffer[end] == front[end]) end--;
+			if (start > end) continue;
+		}
+
+		// Whole 16-bit words only
+		start &= ~1;
+		end |= 1;
+
+		// The lower half of the screen follows the upper half in GDRAM
 		uint8_t verticalCoord = (y < 32) ? y : y - 32;
 		uint8_t horizontalCmd = (y < 32) ? ST7920_CMD_LINE0 : ST7920_CMD_LINE2;
 
-		for (uint8_t x = 0; x < 8; x++)
+		// One transfer per row, the frames follow each other in the FIFO
+		ST7920_PORT_Select();
+		ST7920_WriteFrame(ST7920_CMD, ST7920_CMD_LINE0 | verticalCoord);
+		ST7920_WriteFrame(ST7920_CMD, horizontalCmd | (start / 2));
+		for (int8_t n = start; n <= end; n++)
 		{
-			ST7920_SendCmd(ST7920_CMD_LINE0 | verticalCoord);
-			ST7920_SendCmd(horizontalCmd | x);
-			ST7920_SendData(ST7920_Buffer[2 * x + 16 * y]);
-			ST7920_SendData(ST7920_Buffer[2 * x + 1 + 16 * y]);
+			ST7920_WriteFrame(ST7920_DATA, buffer[n]);
+			front[n] = buffer[n];
 		}
+		ST7920_PORT_Deselect();
 	}
+
+	ST7920_FullRefresh = 0;
+
+	ST7920_SendText();
 }
 
 /*******************************************************************
- * @name       : ST7920_SetPixel
- * @function   : Draw a character at specified position
- * @parameters : color, x, y, font, letterNumberAscii
- * @retvalue   : None
+ * @name       :ST7920_Invalidate
+ * @function   :Force the next ST7920_SendBuffer to send every row
+ * @parameters :None
+ * @retvalue   :None
  *******************************************************************/
-void ST7920_SetPixel(uint8_t color, int16_t x, int16_t y) 
+void ST7920_Invalidate(void)
 {
-	if (x >= 0 && x < ST7920_WIDTH && y >= 0 && y < ST7920_HEIGHT) 
-	{
-		uint16_t index = y * (ST7920_WIDTH / ST7920_DATA_SIZE) + (x / ST7920_DATA_SIZE);
-		uint8_t bitOffset = 0x80u >> (x % ST7920_DATA_SIZE);
+	ST7920_FullRefresh = 1;
+}
 
-		if (color) ST7920_Buffer[index] |= bitOffset;
-		else ST7920_Buffer[index] &= ~bitOffset;
-	}
+/*******************************************************************
+ * Row-major layout adapter of the rendering core (Inc/gfx_core.h): 
+ * a byte holds 8 columns of one row, MSB on the left
+ *******************************************************************/
+#define GFX_NAME(name) ST7920_##name
+#define GFX_WIDTH      ST7920_WIDTH
+#define GFX_HEIGHT     ST7920_HEIGHT
+#define GFX_VERTICAL   0
+#define GFX_COLOR_XOR  ST7920_COLOR_XOR
+
+/*******************************************************************
+ * @name       :ST7920_WritePixel
+ * @function   :Write a pixel inside the screen in buffer
+ * @parameters :color, x, y
+ * @retvalue   :None
+ *******************************************************************/
+static inline void ST7920_WritePixel(uint8_t color, int16_t x, int16_t y)
+{
+	ST7920_COUNT_OPS(1);
+	ST7920_SyncBuffer();
+	uint16_t index = y * (ST7920_WIDTH / ST7920_DATA_SIZE) + (x / ST7920_DATA_SIZE);
+	uint8_t bitOffset = 0x80u >> (x % ST7920_DATA_SIZE);
+
+	if (color == ST7920_COLOR_XOR) ST7920_Buffer[index] ^= bitOffset;
+	else if (color) ST7920_Buffer[index] |= bitOffset;
+	else ST7920_Buffer[index] &= ~bitOffset;
 }
 
 /*******************************************************************
- * @name       : ST7920_DrawCharacter
- * @function   : Draw a character at specified position
- * @parameters : color, x, y, font, letterNumberAscii
- * @retvalue   : None
+ * @name       :ST7920_BlitGlyph
+ * @function   :Merge a glyph inside the screen in buffer: font columns 
+ *              are vertical, so each column is one bit walked down 
+ *              the rows of the buffer
+ * @parameters :color, x, y (top left of the stored glyph), rows, data, glyph
+ * @retvalue   :None
  *******************************************************************/
-void ST7920_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii) 
+static void ST7920_BlitGlyph(uint8_t color, int16_t x, int16_t y, int16_t rows, const uint8_t *data, const FontGlyph *glyph)
 {
-	if (letterNumberAscii < font->asciiBegin || letterNumberAscii > font->asciiEnd) return;
-	
-	uint8_t letterNumber = letterNumberAscii - font->asciiOffset;
-	uint16_t index_letterSize = letterNumber * font->datasize;
-	uint8_t letterSize = font->data[index_letterSize];
+	ST7920_SyncBuffer();
 
-	for (int column = 0; column < letterSize; column++) 
+	uint8_t byteCount = glyph->byteCount;
+
+	for (int column = 0; column < glyph->columns; column++, x++)
 	{
-		for (int byteColumn = 0; byteColumn < font->bytesPerColums; byteColumn++) 
+		uint8_t *buffer = &ST7920_Buffer[y * (ST7920_WIDTH / ST7920_DATA_SIZE) + x / ST7920_DATA_SIZE];
+		uint8_t bitOffset = 0x80u >> (x % ST7920_DATA_SIZE);
+		const uint8_t *pixels = &data[byteCount * column];
+
+		for (int row = 0; row < rows; row++, buffer += ST7920_WIDTH / ST7920_DATA_SIZE)
 		{
-			uint16_t index_Buffer = 1 + letterNumber * font->datasize + byteColumn + font->bytesPerColums * column;
-			uint8_t data = font->data[index_Buffer];
-			for (int bit = 0; bit < 8; bit++) 
-			{
-				uint8_t pixel = (data >> bit) & 1;
-				int16_t a = x + column;
-				int16_t b = y + (bit + 8 * byteColumn);
-				if (pixel) ST7920_SetPixel(color, a, b);
-			}
+			if (!((pixels[row / 8] >> (row % 8)) & 1)) continue;
+			ST7920_COUNT_OPS(1);
+
+			if (color == ST7920_COLOR_XOR) *buffer ^= bitOffset;
+			else if (color) *buffer |= bitOffset;
+			else *buffer &= ~bitOffset;
 		}
 	}
 }
 
 /*******************************************************************
- * @name       : ST7920_DrawStr
- * @function   : Set pixel in buffer
- * @parameters : color, x, y, font, content
- * @retvalue   : None
+ * @name       :ST7920_FillArea
+ * @function   :Fill an area of the buffer, row by row: whole bytes 
+ *              with precomputed masks at both ends of each row
+ * @parameters :color, x0, y0, x1, y1 (corners included)
+ * @retvalue   :None
  *******************************************************************/
-void ST7920_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format)
+static void ST7920_FillArea(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-	while (*format && x < ST7920_WIDTH && y < ST7920_HEIGHT) 
-	{
-		uint8_t currentChar = *format;
+	ST7920_SyncBuffer();
 
-		ST7920_DrawCharacter(color, x, y, font, currentChar);
+	//Clip to the screen
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 >= ST7920_WIDTH) x1 = ST7920_WIDTH - 1;
+	if (y1 >= ST7920_HEIGHT) y1 = ST7920_HEIGHT - 1;
+	if (x0 > x1 || y0 > y1) return;
 
-		// Create a space between the letters
-		uint8_t letterNumber = currentChar - font->asciiOffset;
-		uint16_t index_letterSize = letterNumber * font->datasize;
-		uint8_t letterSize = font->data[index_letterSize];
-		x += letterSize + (font->length / 10);
+	uint8_t firstByte = x0 / ST7920_DATA_SIZE;
+	uint8_t lastByte = x1 / ST7920_DATA_SIZE;
 
-		// Go to next letter
-		format++;
-	}
-}
+	for (int16_t y = y0; y <= y1; y++)
+	{
+		uint8_t *buffer = &ST7920_Buffer[y * (ST7920_WIDTH / ST7920_DATA_SIZE)];
 
-/*******************************************************************
- * @name       : ST7920_FontPrint
- * @function   : Set pixel in buffer
- * @parameters : color, x, y, font, content
- * @retvalue   : None
- *******************************************************************/
-void ST7920_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...) 
-{
-	va_list args;
-	va_start(args, format);
-	char formatted_string[50]; 
-	vsprintf(formatted_string, format, args);
-	va_end(args);
+		for (uint8_t n = firstByte; n <= lastByte; n++)
+		{
+			uint8_t mask = 0xFF;
+			if (n == firstByte) mask &= ST7920_MaskFrom[x0 % ST7920_DATA_SIZE];
+			if (n == lastByte) mask &= ST7920_MaskTo[x1 % ST7920_DATA_SIZE];
 
-	ST7920_DrawStr(color, x, y, font, formatted_string); 
+			if (color == ST7920_COLOR_XOR) buffer[n] ^= mask;
+			else if (color) buffer[n] |= mask;
+			else buffer[n] &= ~mask;
+		}
+		ST7920_COUNT_OPS(lastByte - firstByte + 1);
+	}
 }
 
 /*******************************************************************
- * @name       :ST7920_DrawLine
- * @function   :Draw a line
- * @parameters :color, x0, y0, x1, y1
+ * @name       :ST7920_BlitStrip
+ * @function   :Merge a decoded bitmap page in buffer: the strip bytes 
+ *              are columns of 8 rows, each row of the strip gathers 
+ *              the bits of up to 8 columns into one buffer byte, 
+ *              written opaque (bits of the columns replaced), 
+ *              transparent (lit bits only) or XOR (lit bits inverted)
+ * @parameters :x, y (top left of the strip), strip, width, mask 
+ *              (rows belonging to the bitmap), mode
  * @retvalue   :None
  *******************************************************************/
-void ST7920_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) 
+static void ST7920_BlitStrip(int16_t x, int16_t y, const uint8_t *strip, int16_t width, uint8_t mask, uint8_t mode)
 {
-	int dx = (x1 >= x0) ? x1 - x0 : x0 - x1;
-	int dy = (y1 >= y0) ? y1 - y0 : y0 - y1;
-	int sx = (x0 < x1) ? 1 : -1;
-	int sy = (y0 < y1) ? 1 : -1;
-	int err = dx - dy;
+	ST7920_SyncBuffer();
 
-	while(1)
+	for (uint8_t row = 0; row < 8; row++)
 	{
-		ST7920_SetPixel(color, x0, y0);
-		if (x0 == x1 && y0 == y1) break;
-		int e2 = err + err;
-		if (e2 > -dy)
-		{
-			err -= dy;
-			x0 += sx;
-		}
-		if (e2 < dx)
+		int16_t line = y + row;
+		if (!((mask >> row) & 1) || line < 0 || line >= ST7920_HEIGHT) continue;
+
+		uint8_t *buffer = &ST7920_Buffer[line * (ST7920_WIDTH / ST7920_DATA_SIZE)];
+		int16_t column = 0;
+
+		while (column < width)
 		{
-			err += dx;
-			y0 += sy;
+			int16_t pixel = x + column;
+			uint8_t *byte = &buffer[pixel / ST7920_DATA_SIZE];
+			uint8_t bits = 0;
+			uint8_t cover = 0;
+
+			do
+			{
+				uint8_t bitOffset = 0x80u >> (pixel % ST7920_DATA_SIZE);
+				cover |= bitOffset;
+				if ((strip[column] >> row) & 1) bits |= bitOffset;
+				column++;
+				pixel++;
+			} while (column < width && pixel % ST7920_DATA_SIZE);
+
+			if (mode & BITMAP_XOR) *byte ^= bits;
+			else if (mode & BITMAP_TRANSPARENT) *byte |= bits;
+			else *byte = (*byte & ~cover) | bits;
+			ST7920_COUNT_OPS(1);
 		}
 	}
 }
 
-/*******************************************************************
- * @name       :ST7920_DrawRectangle
- * @function   :Draw rectangle
- * @parameters :color, x, y, w, h
- * @retvalue   :None
- *******************************************************************/
-void ST7920_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
-{
-	//Check input parameters
-	if (x >= ST7920_WIDTH || y >= ST7920_HEIGHT) return;
-
-	//Check width and height
-	if ((x + w) >= ST7920_WIDTH) w = ST7920_WIDTH - x;
-	if ((y + h) >= ST7920_HEIGHT) h = ST7920_HEIGHT - y;
-
-	//Draw 4 lines
-	ST7920_DrawLine(color, x, y, x + w, y);         //Top line
-	ST7920_DrawLine(color, x, y + h, x + w, y + h); //Bottom line
-	ST7920_DrawLine(color, x, y, x, y + h);         //Left line
-	ST7920_DrawLine(color, x + w, y, x + w, y + h); //Right line
-}
+#include "../Inc/gfx_core.h"
 
 /*******************************************************************
- * @name       :ST7920_DrawFilledRectangle
- * @function   :Draw rectangle
- * @parameters :color, x, y, w, h
+ * @name       :ST7920_ClearBuffer
+ * @function   :Clear buffer, see ST7920_FillBuffer
+ * @parameters :None
  * @retvalue   :None
  *******************************************************************/
-void ST7920_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+void ST7920_ClearBuffer(void)
 {
-	//Check input parameters
-	if (x >= ST7920_WIDTH || y >= ST7920_HEIGHT) return;
-
-	//Check width and height
-	if ((x + w) >= ST7920_WIDTH) w = ST7920_WIDTH - x;
-	if ((y + h) >= ST7920_HEIGHT) h = ST7920_HEIGHT - y;
-
-	//Draw lines
-	for (int i = 0; i <= h; i++)
-		ST7920_DrawLine(color, x, y + i, x + w, y + i);
+	ST7920_FillBuffer(ST7920_COLOR_OFF);
 }
 
 /*******************************************************************
- * @name       :ST7920_DrawCircle
- * @function   :Draw circle
- * @parameters :color, x0, y0, radius
+ * @name       :ST7920_FillBuffer
+ * @function   :Set all pixels of the buffer. The fill runs on DMA2D 
+ *              and the function returns at once, the first access 
+ *              to the buffer waits for its end.
+ * @parameters :color (1 = on, 0 = off)
  * @retvalue   :None
  *******************************************************************/
-void ST7920_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
+void ST7920_FillBuffer(uint8_t color)
 {
-	int x = radius;
-	int y = 0;
-	int err = 0;
-
-	ST7920_SetPixel(color, x0, y0 + radius);
-	ST7920_SetPixel(color, x0, y0 - radius);
-	ST7920_SetPixel(color, x0 + radius, y0);
-	ST7920_SetPixel(color, x0 - radius, y0);
-
-	while (x >= y)
-	{
-		ST7920_SetPixel(color, x0 + x, y0 + y);
-		ST7920_SetPixel(color, x0 - x, y0 + y);
-		ST7920_SetPixel(color, x0 + x, y0 - y);
-		ST7920_SetPixel(color, x0 - x, y0 - y);
-		ST7920_SetPixel(color, x0 + y, y0 + x);
-		ST7920_SetPixel(color, x0 - y, y0 + x);
-		ST7920_SetPixel(color, x0 + y, y0 - x);
-		ST7920_SetPixel(color, x0 - y, y0 - x);
-
-		y++;
-		err += 1 + 2*y;
-
-		if (2*(err - x) + 1 > 0)
-		{
-			x--;
-			err += 1 - 2*x;
-		}
-	}
+	DMA2D_Fill(ST7920_Buffer, color ? 0xFF : 0x00, sizeof(ST7920_Buffer));
+	ST7920_BufferPending = 1;
 }
 
 /*******************************************************************
- * @name       :ST7920_DrawFilledCircle
- * @function   :Draw filled circle
- * @parameters :color, x0, y0, radius
+ * @name       :ST7920_CopyBuffer
+ * @function   :Replace the buffer with a frame, on DMA2D like 
+ *              ST7920_FillBuffer. The frame must stay unchanged 
+ *              until the next drawing call or ST7920_SendBuffer.
+ * @parameters :frame (16 bytes per row, MSB on the left)
  * @retvalue   :None
  *******************************************************************/
-void ST7920_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r)
+void ST7920_CopyBuffer(const uint8_t *frame)
 {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-	ST7920_SetPixel(color, x0, y0 + r);
-	ST7920_SetPixel(color, x0, y0 - r);
-	ST7920_SetPixel(color, x0 + r, y0);
-	ST7920_SetPixel(color, x0 - r, y0);
-	ST7920_DrawLine(color, x0 - r, y0, x0 + r, y0);
-
-	while (x < y) 
-	{
-		if (f >= 0) 
-		{
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
-		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
-		
-		ST7920_DrawLine(color, x0 - x, y0 + y, x0 + x, y0 + y);
-		ST7920_DrawLine(color, + x, y0 - y, x0 - x, y0 - y);
-		
-		ST7920_DrawLine(color, + y, y0 + x, x0 - y, y0 + x);
-		ST7920_DrawLine(color, + y, y0 - x, x0 - y, y0 - x);
-	}
+	DMA2D_Copy(ST7920_Buffer, frame, sizeof(ST7920_Buffer));
+	ST7920_BufferPending = 1;
 }
 
 /*******************************************************************
- * @name       :ST7920_ClearBuffer
- * @function   :Clear buffer
+ * @name       :ST7920_InitStep
+ * @function   :Run one step of the initialization of the component;
+ *              the waits of more than 1ms are left to the caller and
+ *              frames are held back until the last step
  * @parameters :None
- * @retvalue   :None
+ * @retvalue   :Milliseconds to wait before the next step, 0 when the
+ *              display is ready
  *******************************************************************/
-void ST7920_ClearBuffer(void)
+uint32_t ST7920_InitStep(void)
 {
-	uint16_t bufferSize = (ST7920_WIDTH*ST7920_HEIGHT)/ST7920_DATA_SIZE;
-	for (int i=0; i<bufferSize; i++)
-		ST7920_Buffer[i] = 0;
+	switch (ST7920_InitState++)
+	{
+		case 0:
+			ST7920_Ready = 0;
+			// Wait 100ms
+			return 100;
+
+		case 1:
+			// Initialize SPI link
+			ST7920_PORT_Init();
+			DMA2D_Init();
+			// Reset LOW
+			ST7920_PORT_Reset(1);
+			// Wait 50ms
+			return 50;
+
+		case 2:
+			// Reset HIGH
+			ST7920_PORT_Reset(0);
+			// Wait 100ms
+			return 100;
+
+		case 3:
+			// 8bit mode
+			ST7920_SendCmd(ST7920_CMD_BASIC);
+			// Wait >100us
+			TIM_WaitMicroseconds(110);
+			// 8bit mode
+			ST7920_SendCmd(ST7920_CMD_BASIC);
+			// Wait >37us
+			TIM_WaitMicroseconds(40);
+			// D=0, C=0, B=0 (Display OFF)
+			ST7920_SendCmd(ST7920_CMD_DISPLAYOFF);
+			// Wait >100us
+			TIM_WaitMicroseconds(110);
+			// Clear screen
+			ST7920_SendCmd(ST7920_CMD_LCD_CLS);
+			// Wait >10ms
+			return 12;
+
+		case 4:
+			// DDRAM is now filled with spaces
+			ST7920_TextClear();
+			for (uint8_t row = 0; row < ST7920_TEXT_ROWS; row++)
+				for (uint8_t column = 0; column < ST7920_TEXT_COLUMNS; column++)
+					ST7920_TextFront[row][column] = ' ';
+			// Cursor increment right, no shift
+			ST7920_SendCmd(ST7920_CMD_ADDRINC);
+			// Wait 1ms
+			return 1;
+
+		case 5:
+			// D=1, C=0, B=0 (Display ON)
+			ST7920_SendCmd(ST7920_CMD_DISPLAYON);
+			// Wait 1ms
+			return 1;
+
+		case 6:
+			// Return to home
+			ST7920_SendCmd(ST7920_CMD_HOME);
+			// Wait 1ms
+			return 1;
+
+		default:
+			ST7920_InitState = 0;
+			ST7920_Ready = 1;
+			return 0;
+	}
 }
 
 /*******************************************************************
  * @name       :ST7920_Init
- * @function   :Initialization of the component
+ * @function   :Initialization of the component with busy waits, for
+ *              programs without the scheduler
  * @parameters :None
  * @retvalue   :None
  *******************************************************************/
 void ST7920_Init(void)
 {
-	// Wait 100ms
-	TIM1_WaitMilliseconds(100);
-	// Initialize SPI link
-	ST7920_SpiInit();
-	// Reset LOW
-	ST7920_RST_LOW;
-	// Wait 50ms
-	TIM1_WaitMilliseconds(50);
-	// Reset HIGH
-	ST7920_RST_HIGH;
-	// Wait 100ms
-	TIM1_WaitMilliseconds(100);
-	// 8bit mode
-	ST7920_SendCmd(ST7920_CMD_BASIC);
-	// Wait >100us
-	TIM1_WaitMicroseconds(110);
-	// 8bit mode
-	ST7920_SendCmd(ST7920_CMD_BASIC);
-	// Wait >37us
-	TIM1_WaitMicroseconds(40);
-	// D=0, C=0, B=0 (Display OFF)
-	ST7920_SendCmd(ST7920_CMD_DISPLAYOFF);
-	// Wait >100us
-	TIM1_WaitMicroseconds(110);
-	// Clear screen
-	ST7920_SendCmd(ST7920_CMD_LCD_CLS);
-	// Wait >10ms
-	TIM1_WaitMilliseconds(12);
-	// Cursor increment right, no shift
-	ST7920_SendCmd(ST7920_CMD_ADDRINC);
-	// Wait 1ms
-	TIM1_WaitMilliseconds(1);
-	// D=1, C=0, B=0 (Display ON)
-	ST7920_SendCmd(ST7920_CMD_DISPLAYON);
-	// Wait 1ms
-	TIM1_WaitMilliseconds(1);
-	// Return to home
-	ST7920_SendCmd(ST7920_CMD_HOME);
-	// Wait 1ms
-	TIM1_WaitMilliseconds(1);
+	uint32_t delay;
+
+	while ((delay = ST7920_InitStep())) TIM_WaitMilliseconds(delay);
 }
@@ -0,0 +1,131 @@
+#include "../Inc/st7920_port.h"
+
+static void ST7920_PORT_SpiFlush(void);
+
+/*******************************************************************
+ * @name       :ST7920_PORT_Init
+ * @function   :SPI Initialization
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void ST7920_PORT_Init(void)
+{
+	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN; // enable clock for GPIOA
+	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN; // enable clock for GPIOC
+
+	// Initialization of pin PA0-DC
+	GPIOA->MODER |= GPIO_MODER_MODER0_0;
+	GPIOA->MODER &= ~GPIO_MODER_MODER0_1;
+
+	// Initialization of pin PC0-CS
+	GPIOC->MODER |= GPIO_MODER_MODER0_0;
+	GPIOC->MODER &= ~GPIO_MODER_MODER0_1;
+
+	// Initialization of pin PC1-RST
+	GPIOC->MODER |= GPIO_MODER_MODER1_0;
+	GPIOC->MODER &= ~GPIO_MODER_MODER1_1;
+
+	// Initialization of pin PA5-SCK
+	GPIOA->MODER |= GPIO_MODER_MODER5_1;
+	GPIOA->MODER &= ~GPIO_MODER_MODER5_0;
+
+	// Initialization of pin PA7-MOSI
+	GPIOA->MODER |= GPIO_MODER_MODER7_1;
+	GPIOA->MODER &= ~GPIO_MODER_MODER7_0;
+
+	GPIOA->AFR[0] |= ST7920_SPI1_AF << GPIO_AFRL_AFRL5_Pos;
+	GPIOA->AFR[0] |= ST7920_SPI1_AF << GPIO_AFRL_AFRL7_Pos;
+
+	//Enable clock access to SPI1 module
+	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+
+	//Set MSB first
+	SPI1->CR1 &= ~SPI_CR1_LSBFIRST;
+
+	//Set mode to MASTER
+	SPI1->CR1 |= SPI_CR1_MSTR;
+
+	//Select software slave management by setting SSM=1 and SSI=1
+	SPI1->CR1 |= SPI_CR1_SSM;
+	SPI1->CR1 |= SPI_CR1_SSI;
+
+	//Set SPI mode to be MODE1 (CPHA0 CPOL0)
+	SPI1->CR1 |= SPI_CR1_CPHA;
+	SPI1->CR1 &= ~SPI_CR1_CPOL;
+
+	//Set the frequency of SPI to 1MHz
+	SPI1->CR1 |= ST7920_SPI_BR;
+
+	//Enable SPI module
+	SPI1->CR1 |= SPI_CR1_SPE;
+}
+
+/*******************************************************************
+ * @name       :ST7920_PORT_Reset
+ * @function   :Drive the reset line of the controller
+ * @parameters :active (1 to hold the controller in reset, 0 to
+ *              release it)
+ * @retvalue   :None
+ *******************************************************************/
+void ST7920_PORT_Reset(uint8_t active)
+{
+	if (active) ST7920_RST_LOW;
+	else ST7920_RST_HIGH;
+}
+
+/*******************************************************************
+ * @name       :ST7920_PORT_Select
+ * @function   :Start a transfer (CS is active high)
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void ST7920_PORT_Select(void)
+{
+	ST7920_CS_HIGH;
+}
+
+/*******************************************************************
+ * @name       :ST7920_PORT_Write
+ * @function   :Queue a byte in the SPI TX FIFO, waits only while the
+ *              FIFO is more than half full
+ * @parameters :byte
+ * @retvalue   :None
+ *******************************************************************/
+void ST7920_PORT_Write(uint8_t byte)
+{
+	//Wait until there is room in the TX FIFO
+	while(!(SPI1->SR & (SPI_SR_TXE)));
+
+	//Write the data to the data register
+	*(volatile uint8_t*) & SPI1->DR = byte;
+}
+
+/*******************************************************************
+ * @name       :ST7920_PORT_SpiFlush
+ * @function   :Wait for the end of the transmission and drop the
+ *              bytes received meanwhile
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void ST7920_PORT_SpiFlush(void)
+{
+	//Wait until the TX FIFO is empty and the last byte has left
+	while((SPI1->SR & (SPI_SR_FTLVL)));
+	while((SPI1->SR & (SPI_SR_BSY)));
+
+	//Empty the RX FIFO and clear OVR flag
+	while((SPI1->SR & (SPI_SR_FRLVL))) (void)*(volatile uint8_t*) & SPI1->DR;
+	(void)SPI1->SR;
+}
+
+/*******************************************************************
+ * @name       :ST7920_PORT_Deselect
+ * @function   :End a transfer once all the bytes have been sent
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void ST7920_PORT_Deselect(void)
+{
+	ST7920_PORT_SpiFlush();
+	ST7920_CS_LOW;
+}
@@ -0,0 +1,193 @@
+#include "../Inc/timer.h"
+#include "../Inc/tim.h"
+
+#define TIMER_LEVEL0_SIZE (1U << TIMER_LEVEL0_BITS)
+#define TIMER_LEVEL_SIZE  (1U << TIMER_LEVEL_BITS)
+#define TIMER_RANGE       (1U << (TIMER_LEVEL0_BITS + (TIMER_LEVELS - 1) * TIMER_LEVEL_BITS))
+
+// Slots: level 0 one millisecond each, then 256 ms, 16 s and 17 min
+static TIMER_TypeDef *TIMER_Level0[TIMER_LEVEL0_SIZE];
+static TIMER_TypeDef *TIMER_Levels[TIMER_LEVELS - 1][TIMER_LEVEL_SIZE];
+
+// Next millisecond to process
+static uint32_t TIMER_Current = 0;
+
+/*******************************************************************
+ * @name       : TIMER_Add
+ * @brief      : Links a timer in the slot of its expiry
+ * @details    : A timer already late goes in the slot of the next
+ *               tick; a timer beyond the range of the wheel goes in
+ *               the last slot it can reach and is placed again when
+ *               that slot moves down
+ * @parameters : timer - Timer to link
+ * @return     : None
+ *******************************************************************/
+static void TIMER_Add(TIMER_TypeDef *timer)
+{
+	uint32_t expires = timer->expires;
+	int32_t delta = (int32_t)(expires - TIMER_Current);
+	TIMER_TypeDef **slot;
+
+	if (delta < 0)
+	{
+		expires = TIMER_Current;
+		delta = 0;
+	}
+	else if ((uint32_t)delta >= TIMER_RANGE)
+	{
+		expires = TIMER_Current + TIMER_RANGE - 1;
+		delta = TIMER_RANGE - 1;
+	}
+
+	if ((uint32_t)delta < TIMER_LEVEL0_SIZE)
+	{
+		slot = &TIMER_Level0[expires & (TIMER_LEVEL0_SIZE - 1)];
+	}
+	else
+	{
+		uint8_t level = 0;
+		uint8_t shift = TIMER_LEVEL0_BITS;
+
+		while ((uint32_t)delta >= (1U << (shift + TIMER_LEVEL_BITS)))
+		{
+			level++;
+			shift += TIMER_LEVEL_BITS;
+		}
+		slot = &TIMER_Levels[level][(expires >> shift) & (TIMER_LEVEL_SIZE - 1)];
+	}
+
+	timer->next = *slot;
+	if (timer->next) timer->next->link = &timer->next;
+	*slot = timer;
+	timer->link = slot;
+}
+
+/*******************************************************************
+ * @name       : TIMER_Remove
+ * @brief      : Unlinks a timer from its slot
+ * @parameters : timer - Linked timer
+ * @return     : None
+ *******************************************************************/
+static void TIMER_Remove(TIMER_TypeDef *timer)
+{
+	*timer->link = timer->next;
+	if (timer->next) timer->next->link = timer->link;
+	timer->link = 0;
+}
+
+/*******************************************************************
+ * @name       : TIMER_Cascade
+ * @brief      : Moves the timers of an upper slot to lower levels
+ * @parameters : level - Upper level (1 to TIMER_LEVELS - 1)
+ *               index - Slot in the level
+ * @return     : None
+ *******************************************************************/
+static void TIMER_Cascade(uint8_t level, uint32_t index)
+{
+	TIMER_TypeDef *timer = TIMER_Levels[level - 1][index];
+	TIMER_Levels[level - 1][index] = 0;
+
+	while (timer)
+	{
+		TIMER_TypeDef *next = timer->next;
+		TIMER_Add(timer);
+		timer = next;
+	}
+}
+
+/*******************************************************************
+ * @name       : TIMER_Tick
+ * @brief      : Runs the timers of the current millisecond
+ * @details    : When level 0 wraps, the next slot of level 1 moves
+ *               down first, and so on up the levels. A periodic
+ *               timer is linked again before its callback, which may
+ *               stop or restart it.
+ * @parameters : None
+ * @return     : None
+ *******************************************************************/
+static void TIMER_Tick(void)
+{
+	uint32_t index = TIMER_Current & (TIMER_LEVEL0_SIZE - 1);
+
+	if (!index)
+	{
+		for (uint8_t level = 1; level < TIMER_LEVELS; level++)
+		{
+			uint32_t slot = (TIMER_Current >> (TIMER_LEVEL0_BITS + (level - 1) * TIMER_LEVEL_BITS)) & (TIMER_LEVEL_SIZE - 1);
+			TIMER_Cascade(level, slot);
+			if (slot) break;
+		}
+	}
+
+	while (TIMER_Level0[index])
+	{
+		TIMER_TypeDef *timer = TIMER_Level0[index];
+
+		TIMER_Remove(timer);
+		if (timer->period)
+		{
+			timer->expires = TIMER_Current + timer->period;
+			TIMER_Add(timer);
+		}
+		timer->callback(timer->context);
+	}
+
+	TIMER_Current++;
+}
+
+/*******************************************************************
+ * @name       : TIMER_Start
+ * @brief      : Starts or restarts a timer
+ * @parameters : timer - Timer, kept by the caller while it is active
+ *               delay - Milliseconds before the first run
+ *               period - Milliseconds between the next runs, 0 to run
+ *                        once
+ *               callback - Function to run
+ *               context - Argument of the callback
+ * @return     : None
+ *******************************************************************/
+void TIMER_Start(TIMER_TypeDef *timer, uint32_t delay, uint32_t period, TIMER_Callback callback, void *context)
+{
+	if (timer->link) TIMER_Remove(timer);
+
+	timer->expires = TIM_GetMilliseconds() + delay;
+	timer->period = period;
+	timer->callback = callback;
+	timer->context = context;
+	TIMER_Add(timer);
+}
+
+/*******************************************************************
+ * @name       : TIMER_Stop
+ * @brief      : Stops a timer
+ * @details    : Does nothing if the timer is not active
+ * @parameters : timer - Timer
+ * @return     : None
+ *******************************************************************/
+void TIMER_Stop(TIMER_TypeDef *timer)
+{
+	if (timer->link) TIMER_Remove(timer);
+}
+
+/*******************************************************************
+ * @name       : TIMER_IsActive
+ * @brief      : Returns the state of a timer
+ * @parameters : timer - Timer
+ * @return     : 1 if the timer will run, 0 otherwise
+ *******************************************************************/
+uint8_t TIMER_IsActive(const TIMER_TypeDef *timer)
+{
+	return timer->link ? 1 : 0;
+}
+
+/*******************************************************************
+ * @name       : TIMER_Process
+ * @brief      : Runs the timers due up to a millisecond
+ * @details    : Catches up one tick at a time after a long task
+ * @parameters : now - Current millisecond (TIM_GetMilliseconds)
+ * @return     : None
+ *******************************************************************/
+void TIMER_Process(uint32_t now)
+{
+	while ((int32_t)(now - TIMER_Current) >= 0) TIMER_Tick();
+}
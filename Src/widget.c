@@ -0,0 +1,107 @@
+#include "../Inc/widget.h"
+#include "../Inc/sh1106.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// Returns the height of the ink of a glyph from the top of the character 
+// cell, limited to the font height like DrawCharacter
+static int16_t WIDGET_GlyphBottom(const Font *font, const FontGlyph *glyph)
+{
+	// Only the last stored byte row can hold the lowest ink row
+	const uint8_t *data = &font->data[glyph->offset + glyph->byteCount - 1];
+	uint8_t bits = 0;
+	for (uint8_t column = 0; column < glyph->columns; column++, data += glyph->byteCount)
+		bits |= *data;
+
+	int16_t bottom = 8 * (glyph->firstByte + glyph->byteCount - 1);
+	for (; bits; bits >>= 1) bottom++;
+	return (bottom > font->height) ? font->height : bottom;
+}
+
+// Returns the length of the longest prefix of a string whose glyphs stay 
+// inside the widget rectangle
+static size_t WIDGET_Fit(const WIDGET_TextTypeDef *widget, const char *text)
+{
+	const Font *font = widget->font;
+	int16_t x = 0;
+	size_t length = 0;
+
+	for (; text[length]; length++)
+	{
+		const FontGlyph *glyph = FONT_GetGlyph(font, text[length]);
+		if (!glyph) continue;
+
+		if (glyph->columns)
+		{
+			if (x + glyph->xOffset + glyph->columns > widget->width) break;
+			if (WIDGET_GlyphBottom(font, glyph) > widget->height) break;
+		}
+
+		// Same advance and letter spacing as DrawStr
+		x += glyph->advance + (font->length / 10);
+	}
+	return length;
+}
+
+/*******************************************************************
+ * @name       : WIDGET_Print
+ * @brief      : Updates the text of a widget
+ * @details    : Formats the string and compares it with the one 
+ *               already drawn; only when it differs is the widget 
+ *               rectangle cleared and the new string drawn, so 
+ *               unchanged widgets cost no buffer writes and leave 
+ *               no dirty columns. The string is cut before the 
+ *               first character that does not fit in the rectangle, 
+ *               so no pixel is drawn outside what WIDGET_Clear erases
+ * @parameters : widget - Widget to update
+ *               format - Formatted string to be displayed
+ * @return     : 1 if the widget was redrawn, 0 otherwise
+ *******************************************************************/
+uint8_t WIDGET_Print(WIDGET_TextTypeDef *widget, const char *format, ...)
+{
+	char text[WIDGET_TEXT_SIZE];
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(text, sizeof(text), format, args);
+	va_end(args);
+
+	if (widget->valid && strcmp(text, widget->text) == 0) return 0;
+
+	WIDGET_Clear(widget);
+	strcpy(widget->text, text);
+
+	text[WIDGET_Fit(widget, text)] = '\0';
+	SH1106_DrawStr(1, widget->x, widget->y, widget->font, text);
+	widget->valid = 1;
+	return 1;
+}
+
+/*******************************************************************
+ * @name       : WIDGET_Clear
+ * @brief      : Erases a widget
+ * @details    : Clears the widget rectangle in the buffer and forgets 
+ *               the cached string, the next print draws again
+ * @parameters : widget - Widget to erase
+ * @return     : None
+ *******************************************************************/
+void WIDGET_Clear(WIDGET_TextTypeDef *widget)
+{
+	SH1106_DrawFilledRectangle(0, widget->x, widget->y, widget->width - 1, widget->height - 1);
+	widget->valid = 0;
+}
+
+/*******************************************************************
+ * @name       : WIDGET_Invalidate
+ * @brief      : Forgets the cached string of a widget
+ * @details    : To be called when the buffer was cleared under the 
+ *               widget, the next print draws again
+ * @parameters : widget - Widget to invalidate
+ * @return     : None
+ *******************************************************************/
+void WIDGET_Invalidate(WIDGET_TextTypeDef *widget)
+{
+	widget->valid = 0;
+}
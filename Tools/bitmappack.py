@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Converts PBM images into run-length encoded bitmaps.
+
+The input is one or more PBM files (plain P1 or raw P4, 1 = lit pixel),
+see Bitmaps/Source. The bitmap is cut into pages of 8 rows, each page
+being one byte per column, LSB at the top, like the SH1106 display RAM
+and the fonts.
+
+Every page is encoded on its own (runs never cross a page), as a
+sequence of runs introduced by a control byte n:
+    n < 0x80    n + 1 literal bytes follow
+    n >= 0x80   the next byte is repeated (n & 0x7F) + 1 times
+as described by Bitmap in Bitmaps/bitmaps.h. The name of a bitmap comes
+from its file name: icon_alarm.pbm becomes IconAlarm.
+
+Usage:
+    python3 Tools/bitmappack.py Bitmaps/bitmaps_icons.c Bitmaps/Source/icon_*.pbm
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MAX_RUN = 0x80
+
+
+def parse_pbm(path):
+    """Returns (width, height, rows of 0/1 pixels) from a PBM file."""
+    with open(path, "rb") as handle:
+        content = handle.read()
+
+    # Header: magic, width, height, comments allowed between the fields
+    tokens = []
+    position = 0
+    while len(tokens) < 3:
+        match = re.compile(rb"\s*(#[^\n]*\n\s*)*(\S+)").match(content, position)
+        if not match:
+            sys.exit("bitmappack: %s: truncated header" % path)
+        tokens.append(match.group(2))
+        position = match.end()
+
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    if not 0 < width <= 255 or not 0 < height <= 255:
+        sys.exit("bitmappack: %s: %dx%d is out of range (1 to 255)" % (path, width, height))
+
+    if magic == b"P1":
+        body = re.sub(rb"#[^\n]*", b"", content[position:])
+        bits = [int(value) for value in re.findall(rb"[01]", body)]
+    elif magic == b"P4":
+        body = content[position + 1:]
+        stride = (width + 7) // 8
+        bits = [(body[y * stride + x // 8] >> (7 - x % 8)) & 1 for y in range(height) for x in range(width)]
+    else:
+        sys.exit("bitmappack: %s: only P1 and P4 images are supported" % path)
+
+    if len(bits) < width * height:
+        sys.exit("bitmappack: %s: truncated image" % path)
+    return width, height, [bits[y * width:(y + 1) * width] for y in range(height)]
+
+
+def to_pages(width, height, rows):
+    """Returns the pages of the image, each one a list of column bytes."""
+    pages = []
+    for page in range((height + 7) // 8):
+        columns = []
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and rows[y][x]:
+                    byte |= 1 << bit
+            columns.append(byte)
+        pages.append(columns)
+    return pages
+
+
+def encode_page(data):
+    """Encodes one page, repeats of 3 bytes or more become runs."""
+    out = []
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    index = 0
+    while index < len(data):
+        count = 1
+        while index + count < len(data) and data[index + count] == data[index] and count < MAX_RUN:
+            count += 1
+        if count >= 3:
+            flush()
+            out.append(0x80 | (count - 1))
+            out.append(data[index])
+        else:
+            literal.extend(data[index:index + count])
+        index += count
+    flush()
+    return out
+
+
+def decode_page(stream, position, width):
+    """Reference decoder, used to check the encoder output."""
+    out = []
+    while len(out) < width:
+        control = stream[position]
+        if control & 0x80:
+            out.extend([stream[position + 1]] * ((control & 0x7F) + 1))
+            position += 2
+        else:
+            out.extend(stream[position + 1:position + 2 + control])
+            position += control + 2
+    return out, position
+
+
+def bitmap_name(path):
+    base = os.path.splitext(os.path.basename(path))[0]
+    return "".join(part.capitalize() for part in re.split(r"[^A-Za-z0-9]+", base) if part)
+
+
+def generate(output, bitmaps):
+    guard = "BITMAPS_%s_H_" % re.sub(r"\W", "_", os.path.splitext(os.path.basename(output))[0]).upper()
+
+    out = []
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("#include \"bitmaps.h\"")
+    out.append("")
+    out.append("// Generated by Tools/bitmappack.py, do not edit")
+
+    for name, source, width, height, pages in bitmaps:
+        stream = []
+        for page in pages:
+            stream.extend(encode_page(page))
+
+        position = 0
+        for page in pages:
+            decoded, position = decode_page(stream, position, width)
+            assert decoded == page, "bitmappack: %s: encoder check failed" % name
+
+        out.append("")
+        out.append("// %s: %dx%d, %d -> %d bytes" % (source, width, height, width * len(pages), len(stream)))
+        out.append("static const uint8_t %s_Data[] =" % name)
+        out.append("{")
+        position = 0
+        for number, page in enumerate(pages):
+            _, end = decode_page(stream, position, width)
+            out.append("\t" + ", ".join("0x%02X" % value for value in stream[position:end]) + ",  // Page %d" % number)
+            position = end
+        out.append("};")
+        out.append("")
+        out.append("const Bitmap %s = {" % name)
+        out.append("\t.data = %s_Data," % name)
+        out.append("\t.width = %d," % width)
+        out.append("\t.height = %d" % height)
+        out.append("};")
+
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack PBM images into run-length encoded bitmaps")
+    parser.add_argument("output", help="C file to write")
+    parser.add_argument("inputs", nargs="+", help="PBM images")
+    args = parser.parse_args()
+
+    root = os.path.dirname(os.path.abspath(args.output)) + "/.."
+    bitmaps = []
+    for path in args.inputs:
+        width, height, rows = parse_pbm(path)
+        source = os.path.relpath(path, root).replace(os.sep, "/")
+        bitmaps.append((bitmap_name(path), source, width, height, to_pages(width, height, rows)))
+
+    with open(args.output, "w", newline="\n") as handle:
+        handle.write(generate(args.output, bitmaps))
+
+    for name, _, width, height, pages in bitmaps:
+        size = sum(len(encode_page(page)) for page in pages)
+        print("%s: %dx%d, %d -> %d bytes" % (name, width, height, width * len(pages), size))
+
+
+if __name__ == "__main__":
+    main()
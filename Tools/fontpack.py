@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""Converts a fixed-size GLCD font export into the packed font format.
+
+The input is a C file as exported by GLCD Font Creator (see Fonts/Source):
+every glyph takes `datasize` bytes, a width byte followed by the column
+bytes, each column being `bytesPerColums` bytes, LSB first.
+
+The output keeps only the non-empty part of each glyph (blank columns on
+both sides and blank bytes at the top and bottom of the columns are
+trimmed) and adds a glyph table with the data offset and the advance of
+every character, as described by FontGlyph in Fonts/fonts.h.
+
+Usage:
+    python3 Tools/fontpack.py Fonts/Source/fonts_arial12x12.c Fonts/fonts_arial12x12.c
+    python3 Tools/fontpack.py Fonts/Source/fonts_arial28x28.c Fonts/fonts_arial28x28.c
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+def parse_glcd(text):
+    """Returns (name, data bytes, font fields) from a GLCD font export."""
+    match = re.search(r"const\s+uint8_t\s+(\w+)_Data\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not match:
+        sys.exit("fontpack: no <Name>_Data[] array found")
+    name = match.group(1)
+    body = re.sub(r"//[^\n]*", "", match.group(2))
+    data = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+    match = re.search(r"const\s+Font\s+" + name + r"\s*=\s*\{(.*?)\};", text, re.S)
+    if not match:
+        sys.exit("fontpack: no Font %s structure found" % name)
+    fields = {key: int(value, 0) for key, value in re.findall(r"\.(\w+)\s*=\s*(\w+)", match.group(1))
+              if re.match(r"^(0x[0-9A-Fa-f]+|\d+)$", value)}
+    return name, data, fields
+
+
+def pack_glyph(raw, bytes_per_column):
+    """Trims a glyph. Returns (advance, xOffset, firstByte, columns as byte lists)."""
+    advance = raw[0]
+    columns = [raw[1 + c * bytes_per_column:1 + (c + 1) * bytes_per_column] for c in range(advance)]
+
+    used = [c for c in range(advance) if any(columns[c])]
+    if not used:
+        return advance, 0, 0, []
+    first, last = used[0], used[-1]
+    columns = columns[first:last + 1]
+
+    rows = [b for b in range(bytes_per_column) if any(column[b] for column in columns)]
+    top, bottom = rows[0], rows[-1]
+    return advance, first, top, [column[top:bottom + 1] for column in columns]
+
+
+def char_name(code):
+    if code == 0x7F:
+        return "DEL"
+    return repr(chr(code))
+
+
+def generate(name, data, fields, source):
+    datasize = fields["datasize"]
+    bytes_per_column = fields["bytesPerColums"]
+    offset = fields["asciiOffset"]
+    count = len(data) // datasize
+    guard = "FONTS_%s_H_" % name.upper()
+
+    out = []
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("#include \"fonts.h\"")
+    out.append("")
+    out.append("// Generated by Tools/fontpack.py from %s, do not edit" % source)
+    out.append("")
+    out.append("static const uint8_t %s_Data[] =" % name)
+    out.append("{")
+
+    glyphs = []
+    position = 0
+    for index in range(count):
+        raw = data[index * datasize:(index + 1) * datasize]
+        advance, x_offset, first_byte, columns = pack_glyph(raw, bytes_per_column)
+        byte_count = len(columns[0]) if columns else 0
+        glyphs.append((position, advance, x_offset, len(columns), first_byte, byte_count))
+        flat = [value for column in columns for value in column]
+        if flat:
+            out.append("\t" + ", ".join("0x%02X" % value for value in flat) + ",  // Code for char %s" % char_name(offset + index))
+        position += len(flat)
+
+    if position == 0:
+        out.append("\t0x00")
+    out.append("};")
+    out.append("")
+    out.append("static const FontGlyph %s_Glyphs[] =" % name)
+    out.append("{")
+    out.append("\t// offset, advance, xOffset, columns, firstByte, byteCount")
+    for index, glyph in enumerate(glyphs):
+        separator = "," if index + 1 < count else " "
+        out.append("\t{%5d, %2d, %2d, %2d, %d, %d}%s // Code for char %s" % (glyph + (separator, char_name(offset + index))))
+    out.append("};")
+    out.append("")
+    out.append("const Font %s = {" % name)
+    out.append("\t.data = %s_Data," % name)
+    out.append("\t.glyphs = %s_Glyphs," % name)
+    out.append("\t.asciiBegin = %d," % offset)
+    out.append("\t.asciiEnd = %d," % (offset + count - 1))
+    out.append("\t.length = %d," % fields["length"])
+    out.append("\t.height = %d," % fields["height"])
+    out.append("\t.bytesPerColums = %d" % bytes_per_column)
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    return "\n".join(out), position, count * datasize
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack a GLCD font export into the trimmed font format")
+    parser.add_argument("input", help="GLCD Font Creator C export")
+    parser.add_argument("output", help="packed C font to write")
+    args = parser.parse_args()
+
+    with open(args.input, encoding="latin-1") as handle:
+        name, data, fields = parse_glcd(handle.read())
+
+    # The header names the source relative to the repository root, the parent of Tools
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    source = os.path.relpath(os.path.abspath(args.input), root).replace(os.sep, "/")
+    text, packed, original = generate(name, data, fields, source)
+    with open(args.output, "w", newline="\n") as handle:
+        handle.write(text)
+
+    print("%s: %d -> %d bitmap bytes" % (name, original, packed))
+
+
+if __name__ == "__main__":
+    main()